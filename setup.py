@@ -36,7 +36,7 @@ setup(
         "strictyaml",
         "importlib_resources; python_version < \"3.9\""
     ],
-    package_data={"eputgen": ["c/eput_utils.c", "c/eput_utils.h"]},
+    package_data={"eputgen": ["c/eput_utils.c", "c/eput_utils.h", "cpp/eput_utils.hpp"]},
     entry_points={
         "console_scripts": [
             "eputgen=eputgen:main",
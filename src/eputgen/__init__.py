@@ -1,8 +1,8 @@
 """Imports all public members of module.
 """
 
-from .blob_generator    import generate_metadata, generate_data
+from .blob_generator    import generate_metadata, generate_data, serialize_properties
 from .lib_generator     import generate_lib_header, generate_lib_code
-from .yaml_parser       import parse, get_properties, get_device_info, get_ids
-from .export            import export_rom_blob, export_all, export_lib, HASH_MD5, HASH_SHA1, HASH_SHA256, HASH_CRC32
+from .yaml_parser       import parse, get_properties, get_device_info, get_ids, compile_descriptor, CompiledDescriptor
+from .export            import export_rom_blob, export_rom_image, export_all, export_lib, export_batch, export_dictionary, HASH_MD5, HASH_SHA1, HASH_SHA256, HASH_CRC32
 from .main              import main
@@ -12,7 +12,22 @@ DEVICE_TYPE_CODE = {
     "Custom_NoTruncate": 0b10000000
 }
 
-def generate_metadata(dev_info, ids, properties, translations, compress) -> bytes:
+# Length of the substrings counted when training a dictionary
+DICTIONARY_SEGMENT_LENGTH = 8
+DICTIONARY_SIZE = 4096
+
+# First byte of indexed translation sections, flat sections start with a language code or 0
+TRANSLATIONS_INDEXED = 0x01
+
+def generate_metadata(
+        dev_info,
+        ids,
+        properties,
+        translations,
+        compress,
+        dictionary=None,
+        indexed_translations=False,
+        serialized_properties=None) -> bytes:
     """Generates the binary representation of the provided configuration's metadata.
 
     Args:
@@ -21,27 +36,86 @@ def generate_metadata(dev_info, ids, properties, translations, compress) -> byte
         properties (list): all properties in configuration
         translations (YAML): the translation data
         compress_metadata (bool): compress metadata with deflate
+        dictionary (bytes): preset dictionary for deflate, see train_dictionary
+        indexed_translations (bool): serialize translations with offset tables, see serialize_metadata
+        serialized_properties (bytes): result of serialize_properties, reused instead of serializing properties again
 
     Returns:
         bytes: the binary metadata
     """
 
-    metadata = []
-    metadata.extend(_serialize_device_info(dev_info))
-    for prop in properties:
-        metadata.extend(prop.serialize())
-    metadata.append(0xFF)
-    metadata.extend(_serialize_translations(ids, translations))
-    metadata_bytes = bytes(metadata)
+    metadata_bytes = serialize_metadata(dev_info, ids, properties, translations, indexed_translations, serialized_properties)
     if compress:
         old_len = len(metadata_bytes)
-        metadata_bytes = compress_metadata(metadata_bytes)
+        metadata_bytes = compress_metadata(metadata_bytes, dictionary)
         new_len = len(metadata_bytes)
         print(f"Requested compression of metadata: {old_len} -> {new_len}, {new_len // (old_len / 100)}%")
+        if dictionary is not None:
+            print(f"Compressed with dictionary, remember to add 'dict={get_dictionary_id(dictionary):08x}' argument to NDEF metadata type URI")
     else:
         print("Compression disabled, remember to add 'zip=0' argument to NDEF metadata type URI")
     return metadata_bytes
 
+def serialize_metadata(dev_info, ids, properties, translations, indexed_translations=False, serialized_properties=None) -> bytes:
+    """Generates the uncompressed binary representation of the provided configuration's metadata.
+    Indexed translations allow looking up a single string without reading the preceding ones,
+    the translation section starts at get_translations_offset.
+
+    Args:
+        dev_info: device info
+        ids (list): all IDs in configuration
+        properties (list): all properties in configuration
+        translations (YAML): the translation data, or the plain data of the translations of a compiled descriptor
+        indexed_translations (bool): serialize translations with offset tables instead of consecutive strings
+        serialized_properties (bytes): result of serialize_properties, reused instead of serializing properties again
+
+    Returns:
+        bytes: the binary metadata
+    """
+
+    if serialized_properties is None:
+        serialized_properties = serialize_properties(properties)
+    metadata = []
+    metadata.extend(_serialize_device_info(dev_info))
+    metadata.extend(serialized_properties)
+    metadata.append(0xFF)
+    if indexed_translations:
+        metadata.extend(_serialize_indexed_translations(ids, translations))
+    else:
+        metadata.extend(_serialize_translations(ids, translations))
+    return bytes(metadata)
+
+def serialize_properties(properties) -> bytes:
+    """Generates the binary representation of all properties, the part of the metadata independent of translations.
+
+    Args:
+        properties (list): all properties in configuration
+
+    Returns:
+        bytes: the serialized properties
+    """
+
+    serialized = []
+    for prop in properties:
+        serialized.extend(prop.serialize())
+    return bytes(serialized)
+
+def get_translations_offset(dev_info, properties, serialized_properties=None) -> int:
+    """Get the offset of the translation section in uncompressed metadata.
+
+    Args:
+        dev_info: device info
+        properties (list): all properties in configuration
+        serialized_properties (bytes): result of serialize_properties, reused instead of serializing properties again
+
+    Returns:
+        int: the offset
+    """
+
+    if serialized_properties is None:
+        serialized_properties = serialize_properties(properties)
+    return len(_serialize_device_info(dev_info)) + len(serialized_properties) + 1
+
 def generate_data(properties) -> bytes:
     data = []
     for prop in properties:
@@ -52,8 +126,73 @@ def generate_data(properties) -> bytes:
         data.append(0)
     return bytes(data)
 
-def compress_metadata(metadata) -> bytes:
-    return zlib.compress(metadata, zlib.Z_BEST_COMPRESSION)
+def compress_metadata(metadata, dictionary=None) -> bytes:
+    if dictionary is None:
+        return zlib.compress(metadata, zlib.Z_BEST_COMPRESSION)
+    compressor = zlib.compressobj(zlib.Z_BEST_COMPRESSION, zdict=dictionary)
+    return compressor.compress(metadata) + compressor.flush()
+
+def get_dictionary_id(dictionary) -> int:
+    """Get the ID of a preset dictionary, which is stored in the header of data compressed with it.
+
+    Args:
+        dictionary (bytes): the dictionary
+
+    Returns:
+        int: Adler-32 checksum of the dictionary
+    """
+
+    return zlib.adler32(dictionary)
+
+def train_dictionary(samples, size=DICTIONARY_SIZE) -> bytes:
+    """Build a preset dictionary for deflate from substrings occuring in many uncompressed metadata blobs.
+
+    Args:
+        samples (list): uncompressed metadata blobs, see serialize_metadata
+        size (int): maximum size of the dictionary in bytes
+
+    Returns:
+        bytes: the dictionary
+    """
+
+    seg_len = DICTIONARY_SEGMENT_LENGTH
+    occurences = {}
+    for sample_index, sample in enumerate(samples):
+        for offset in range(0, len(sample) - seg_len + 1):
+            segment = sample[offset:offset + seg_len]
+            if segment not in occurences:
+                occurences[segment] = (set(), sample_index, offset)
+            occurences[segment][0].add(sample_index)
+    # Segments found in most samples first, segments occuring only once don't help
+    candidates = sorted(
+        filter(lambda item: len(item[1][0]) > 1, occurences.items()),
+        key=lambda item: len(item[1][0]),
+        reverse=True)
+    # Ranges of chosen segments are merged per sample, so overlapping segments form continuous runs
+    covered = {}
+    used = 0
+    for _, (sample_set, sample_index, offset) in candidates:
+        sample_covered = covered.setdefault(sample_index, {})
+        new_bytes = [i for i in range(offset, offset + seg_len) if i not in sample_covered]
+        if used + len(new_bytes) > size:
+            break
+        for i in range(offset, offset + seg_len):
+            sample_covered[i] = max(sample_covered.get(i, 0), len(sample_set))
+        used += len(new_bytes)
+    runs = []
+    for sample_index, sample_covered in covered.items():
+        start = None
+        for i in sorted(sample_covered) + [None]:
+            if start is not None and (i is None or i != end + 1):
+                score = sum(sample_covered[j] for j in range(start, end + 1)) / (end + 1 - start)
+                runs.append((score, samples[sample_index][start:end + 1]))
+                start = None
+            if i is not None and start is None:
+                start = i
+            end = i
+    # Deflate encodes short distances more efficiently, most common runs go to the end
+    runs.sort(key=lambda run: run[0])
+    return b"".join(run for _, run in runs)
 
 def _serialize_device_info(dev_info) -> list:
     serialized = []
@@ -65,18 +204,58 @@ def _serialize_device_info(dev_info) -> list:
     serialized.extend(util.serialize_ascii(dev_info["device_name"]))
     return serialized
 
+def _translation_content(translation):
+    # YAML translation of a descriptor or plain data of a compiled descriptor
+    content = translation.data if isinstance(translation, util.YAML) else translation
+    return content["language"], content["translations"]
+
 def _serialize_translations(ids, translations) -> list:
     serialized = []
     if translations is not None:
         for translation in translations:
-            lang = translation["language"].data
+            lang, strings = _translation_content(translation)
             serialized.extend(util.serialize_ascii(lang))
             for i in ids:
-                try:
-                    translated_str = translation["translations"][i].data
-                    serialized.extend(util.serialize_utf8(translated_str))
-                except KeyError:
+                if i in strings:
+                    serialized.extend(util.serialize_utf8(strings[i]))
+                else:
                     serialized.append(0x00)
     serialized.append(0x00)
     serialized.append(0x00)
     return serialized
+
+def _serialize_indexed_translations(ids, translations) -> list:
+    # Marker, language count, ID count, offsets of language blocks relative to section start.
+    # Each language block contains the language code, offsets of the strings of all IDs relative
+    # to the block start and the strings. Equal strings of a language are only stored once.
+    if translations is None:
+        translations = []
+    if len(translations) > 255:
+        util.error(None, "Too many languages for indexed translations (at most 255)")
+    blocks = []
+    for translation in translations:
+        lang, translated = _translation_content(translation)
+        header = list(util.serialize_ascii(lang))
+        table_end = len(header) + 2 * len(ids)
+        strings = []
+        string_offsets = {}
+        table = []
+        for i in ids:
+            translated_str = util.serialize_utf8(translated.get(i))
+            if translated_str not in string_offsets:
+                string_offsets[translated_str] = table_end + len(strings)
+                strings.extend(translated_str)
+            offset = string_offsets[translated_str]
+            if offset > 0xFFFF:
+                util.error(None, f"Translations of language {lang} too long for indexed translations (at most 64 KiB)")
+            table.extend(offset.to_bytes(length=2, byteorder="big", signed=False))
+        blocks.append(header + table + strings)
+    serialized = [TRANSLATIONS_INDEXED, len(blocks)]
+    serialized.extend(len(ids).to_bytes(length=4, byteorder="big", signed=False))
+    block_offset = len(serialized) + 4 * len(blocks)
+    for block in blocks:
+        serialized.extend(block_offset.to_bytes(length=4, byteorder="big", signed=False))
+        block_offset += len(block)
+    for block in blocks:
+        serialized.extend(block)
+    return serialized
@@ -9,13 +9,63 @@
 #define TLV_TYPE_NDEF 0x03
 
 #define TNF_URI   0x03
+#define TNF_ANY   0xFF
+
+#define RECORD_FLAG_ME 0x40
 #define RECORD_TYPE_SCHEME "https://pma.inftech.hs-mannheim.de/eput"
+#define RECORD_TYPE_SCHEME_LENGTH (sizeof(RECORD_TYPE_SCHEME) - 1)
 
 #define SUCCESS 0
 #define ERR_NO_NDEF_TLV -10
+#define ERR_TLV_TRUNCATED -11
+#define ERR_TLV_INVALID -12
+#define ERR_TLV_END -13
 #define ERR_REC_BUF_TRUNCATED -20
 #define ERR_REC_WRONG_TYPE -21
+#define ERR_REC_END -22
+#define ERR_REC_ARENA_FULL -23
 #define ERR_DATA_BUF_WRONG_LENGTH -30
+#define ERR_STREAM_BUF_FULL -40
+#define ERR_DIGEST_MISMATCH -50
+#define ERR_DIGEST_UNSUPPORTED -51
+#define ERR_ZLIB_HEADER_INVALID -60
+#define ERR_TRANSLATIONS_INVALID -70
+#define ERR_TRANSLATION_NOT_FOUND -71
+#define ERR_ROM_BLOB_INVALID -80
+#define ERR_ROM_BLOB_NOT_FOUND -81
+#define ERR_TRACE_POINT_INVALID -90
+
+#define NDEF_STREAM_NEED_MORE 1
+
+#define NDEF_STREAM_STATE_TLV 0
+#define NDEF_STREAM_STATE_RECORD 1
+#define NDEF_STREAM_STATE_DONE 2
+
+#define LAYOUT_FLAG_MIN_VALUE 0x01
+#define LAYOUT_FLAG_MAX_VALUE 0x02
+#define LAYOUT_FLAG_STEP_SIZE 0x04
+#define LAYOUT_FLAG_FLOAT 0x08
+#define LAYOUT_FLAG_BITS 0x10
+
+#define EPUT_TRACE_TLV_SCAN 0
+#define EPUT_TRACE_RECORD 1
+#define EPUT_TRACE_PARSE_PAYLOAD 2
+#define EPUT_TRACE_GENERATE_PAYLOAD 3
+#define EPUT_TRACE_POINT_COUNT 4
+
+#define CRC32_DIGEST_SIZE 4
+#define SHA256_DIGEST_SIZE 32
+#define SHA256_BLOCK_SIZE 64
+
+#define ZLIB_HEADER_SIZE 2
+#define ZLIB_DICTIONARY_ID_SIZE 4
+#define ZLIB_NO_DICTIONARY 0
+
+#define TRANSLATIONS_INDEXED 0x01
+#define TRANSLATIONS_HEADER_SIZE 6
+
+#define ROM_BLOB_HEADER_SIZE 2
+#define ROM_BLOB_DATA_INDEX 0
 
 typedef int64_t time_point;
 typedef int16_t zone_offset;
@@ -53,6 +103,17 @@ typedef struct {
     int32_t scale;
 } fixp64;
 
+typedef struct {
+    uint8_t type;
+    uint16_t length;
+    size_t value_offset;
+} tlv_block;
+
+// Position in memory while iterating over TLV blocks, start with index 0
+typedef struct {
+    size_t index;
+} tlv_cursor;
+
 typedef struct {
     uint8_t tnf;
     uint8_t type_length;
@@ -63,6 +124,90 @@ typedef struct {
     uint8_t *payload;
 } ndef_record;
 
+// Position in NDEF message while iterating over records, start with index 0
+typedef struct {
+    size_t index;
+    uint8_t end;
+} ndef_record_cursor;
+
+// Records to select while iterating, `TNF_ANY` and a prefix of length 0 match all records
+typedef struct {
+    uint8_t tnf;
+    const uint8_t *type_prefix;
+    uint8_t type_prefix_length;
+} ndef_record_filter;
+
+// State of incremental parsing of NFC memory, initialize with `ndef_stream_init`
+typedef struct {
+    uint8_t *buf;
+    size_t capacity;
+    size_t length;
+    uint8_t state;
+    tlv_cursor cursor;
+    size_t ndef_offset;
+    uint16_t ndef_length;
+} ndef_stream;
+
+// Range of bytes in a payload
+typedef struct {
+    size_t offset;
+    size_t length;
+} byte_range;
+
+// State of a running CRC-32 calculation, initialize with `crc32_init`
+typedef struct {
+    uint32_t state;
+} crc32_ctx;
+
+// State of a running SHA-256 calculation, initialize with `sha256_init`
+typedef struct {
+    uint32_t state[8];
+    uint64_t length;
+    uint8_t block[SHA256_BLOCK_SIZE];
+    size_t block_length;
+} sha256_ctx;
+
+// Indexed translation section of uncompressed metadata, initialize with `open_translations`
+typedef struct {
+    uint8_t *section;
+    size_t length;
+    uint8_t language_count;
+    uint32_t id_count;
+} translation_index;
+
+// ROM blob exported by eputgen, initialize with `open_rom_blob`
+typedef struct {
+    uint8_t *blob;
+    size_t length;
+    uint8_t count;
+    uint8_t digest_size;
+} rom_blob;
+
+// Zero-copy view of a single blob inside a ROM blob
+typedef struct {
+    uint8_t *digest;
+    uint8_t *data;
+    uint32_t length;
+} rom_blob_entry;
+
+// Position and limits of a property in the payload, limits are stored in the `_float` members if `LAYOUT_FLAG_FLOAT` is set
+typedef struct {
+    const char *id;
+    int32_t parent;
+    uint8_t type_code;
+    uint8_t flags;
+    size_t offset;
+    size_t size;
+    size_t count;
+    int64_t min_value;
+    int64_t max_value;
+    int64_t step_size;
+    double min_value_float;
+    double max_value_float;
+    double step_size_float;
+    int32_t scale;
+} property_layout;
+
 uint8_t bytes_to_uint8(uint8_t *bytes);
 uint16_t bytes_to_uint16(uint8_t *bytes);
 uint32_t bytes_to_uint32(uint8_t *bytes);
@@ -107,6 +252,58 @@ void fixp32_to_bytes(fixp32 val, uint8_t *bytes);
 fixp64 bytes_to_fixp64(uint8_t *bytes, int32_t scale);
 void fixp64_to_bytes(fixp64 val, uint8_t *bytes);
 
+// Bulk converters for `count` consecutive big endian values.
+// `stride` is the distance in bytes between two values in `vals`, `sizeof` of the value type if they are contiguous.
+void bytes_to_uint8_array(uint8_t *bytes, uint8_t *vals, size_t count, size_t stride);
+void bytes_to_uint16_array(uint8_t *bytes, uint16_t *vals, size_t count, size_t stride);
+void bytes_to_uint32_array(uint8_t *bytes, uint32_t *vals, size_t count, size_t stride);
+void bytes_to_uint64_array(uint8_t *bytes, uint64_t *vals, size_t count, size_t stride);
+void bytes_to_int8_array(uint8_t *bytes, int8_t *vals, size_t count, size_t stride);
+void bytes_to_int16_array(uint8_t *bytes, int16_t *vals, size_t count, size_t stride);
+void bytes_to_int32_array(uint8_t *bytes, int32_t *vals, size_t count, size_t stride);
+void bytes_to_int64_array(uint8_t *bytes, int64_t *vals, size_t count, size_t stride);
+void bytes_to_float_array(uint8_t *bytes, float *vals, size_t count, size_t stride);
+void bytes_to_double_array(uint8_t *bytes, double *vals, size_t count, size_t stride);
+
+void uint8_array_to_bytes(uint8_t *vals, uint8_t *bytes, size_t count, size_t stride);
+void uint16_array_to_bytes(uint16_t *vals, uint8_t *bytes, size_t count, size_t stride);
+void uint32_array_to_bytes(uint32_t *vals, uint8_t *bytes, size_t count, size_t stride);
+void uint64_array_to_bytes(uint64_t *vals, uint8_t *bytes, size_t count, size_t stride);
+void int8_array_to_bytes(int8_t *vals, uint8_t *bytes, size_t count, size_t stride);
+void int16_array_to_bytes(int16_t *vals, uint8_t *bytes, size_t count, size_t stride);
+void int32_array_to_bytes(int32_t *vals, uint8_t *bytes, size_t count, size_t stride);
+void int64_array_to_bytes(int64_t *vals, uint8_t *bytes, size_t count, size_t stride);
+void float_array_to_bytes(float *vals, uint8_t *bytes, size_t count, size_t stride);
+void double_array_to_bytes(double *vals, uint8_t *bytes, size_t count, size_t stride);
+
+/**
+ * @brief Read the TLV block at the cursor position and advance the cursor past it.
+ * 
+ * NULL TLVs are skipped. The cursor can be passed again to continue with the following TLV.
+ * The value field of the returned TLV may extend past the end of `buf`.
+ * 
+ * @param buf pointer to buffer
+ * @param buf_len length of `buf`
+ * @param cursor position to start reading at
+ * @param tlv pointer to store TLV to
+ * 
+ * @return status code, `ERR_TLV_END` if a terminator TLV or the end of `buf` was reached
+ **/
+int get_next_tlv(uint8_t *buf, size_t buf_len, tlv_cursor *cursor, tlv_block *tlv);
+
+/**
+ * @brief Find the next TLV block of type `type` starting at the cursor position and advance the cursor past it.
+ * 
+ * @param buf pointer to buffer
+ * @param buf_len length of `buf`
+ * @param cursor position to start searching at
+ * @param type TLV type to search for
+ * @param tlv pointer to store TLV to
+ * 
+ * @return status code, `ERR_TLV_END` if no TLV of this type was found
+ **/
+int find_tlv(uint8_t *buf, size_t buf_len, tlv_cursor *cursor, uint8_t type, tlv_block *tlv);
+
 /**
  * @brief Get index and length of value field of first NDEF TLV in `buf`.
  * 
@@ -135,6 +332,19 @@ uint16_t get_ndef_tlv_offset(
  **/
 int get_record(uint8_t *buf, size_t buf_len, ndef_record *record);
 
+/**
+ * @brief Extract only the data record from buffer containing NDEF message.
+ * 
+ * The meta data record following the data record is neither parsed nor validated.
+ * 
+ * @param buf pointer to NDEF message buffer
+ * @param buf_len length of `buf`
+ * @param data_rec pointer to store data record to
+ * 
+ * @return length of data record in `buf` if bigger than 0, otherwise error code
+ **/
+int get_data_record(uint8_t *buf, size_t buf_len, ndef_record *data_rec);
+
 /**
  * @brief Extract meta data and data records from buffer containing NDEF message.
  * 
@@ -151,6 +361,98 @@ int get_records(
     ndef_record *meta_rec,
     ndef_record *data_rec);
 
+/**
+ * @brief Extract the next record matching `filter` starting at the cursor position and advance the cursor past it.
+ * 
+ * Records not matching the filter are skipped. The iteration ends after the record with the message end flag.
+ * 
+ * @param buf pointer to NDEF message buffer
+ * @param buf_len length of `buf`
+ * @param cursor position to start reading at
+ * @param filter records to select, NULL selects all records
+ * @param record pointer to store record to, pointing into `buf`
+ * 
+ * @return status code, `ERR_REC_END` if the end of the message was reached
+ **/
+int get_next_record(
+    uint8_t *buf,
+    size_t buf_len,
+    ndef_record_cursor *cursor,
+    ndef_record_filter *filter,
+    ndef_record *record);
+
+/**
+ * @brief Extract all records matching `filter` from buffer containing NDEF message into a caller-supplied arena.
+ * 
+ * @param buf pointer to NDEF message buffer
+ * @param buf_len length of `buf`
+ * @param filter records to select, NULL selects all records
+ * @param arena pointer to array to store records to
+ * @param capacity number of records fitting into `arena`
+ * @param count pointer to store number of extracted records to
+ * 
+ * @return status code, `ERR_REC_ARENA_FULL` if more records match than fit into `arena`, which is filled in that case
+ **/
+int get_all_records(
+    uint8_t *buf,
+    size_t buf_len,
+    ndef_record_filter *filter,
+    ndef_record *arena,
+    size_t capacity,
+    size_t *count);
+
+/**
+ * @brief Prepare incremental parsing of NFC memory.
+ * 
+ * @param stream pointer to stream state
+ * @param buf buffer to collect memory contents in, must be able to hold memory up to the end of the data record
+ * @param capacity length of `buf`
+ **/
+void ndef_stream_init(ndef_stream *stream, uint8_t *buf, size_t capacity);
+
+/**
+ * @brief Append the next part of NFC memory, e.g. a page, and continue parsing.
+ * 
+ * Memory has to be passed in order starting at the beginning of the tag.
+ * `data` is copied to the stream buffer unless it already points to the next free byte of it.
+ * Once the data record is complete, the record is stored to `data_rec` and the rest of the memory,
+ * including the meta data record, does not have to be read.
+ * 
+ * @param stream pointer to stream state
+ * @param data pointer to next part of memory
+ * @param data_len length of `data`
+ * @param data_rec pointer to store data record to, points into stream buffer
+ * 
+ * @return `NDEF_STREAM_NEED_MORE` while the data record is incomplete, otherwise status code
+ **/
+int ndef_stream_feed(ndef_stream *stream, uint8_t *data, size_t data_len, ndef_record *data_rec);
+
+/**
+ * @brief Add byte range to ascending list of ranges, extending it to page boundaries.
+ * 
+ * `range` is aligned to pages of size `page_size` starting at `base_offset` before `buf`, clipped to `data_len`
+ * and merged with the last range in `ranges` if they overlap or touch.
+ * If `ranges` is full, the last range is extended instead.
+ * 
+ * @param ranges pointer to list of ranges
+ * @param count number of ranges in `ranges`
+ * @param max_ranges capacity of `ranges`
+ * @param range range to add, has to start at or after the start of the last range in `ranges`
+ * @param data_len length of data the ranges belong to
+ * @param page_size size of memory pages, `0` or `1` disable alignment
+ * @param base_offset offset of the data in memory
+ * 
+ * @return new number of ranges in `ranges`
+ **/
+size_t add_byte_range(
+    byte_range *ranges,
+    size_t count,
+    size_t max_ranges,
+    byte_range range,
+    size_t data_len,
+    size_t page_size,
+    size_t base_offset);
+
 /**
  * @brief Determine wether bit with index `option` is set in bitmap.
  * 
@@ -162,4 +464,442 @@ int get_records(
  **/
 uint8_t is_option_selected(uint8_t* bitmap, size_t bitmap_len, uint8_t option);
 
+/**
+ * @brief Get the first 64 options of a bitmap at once, bit n of the result is set if option n is selected.
+ * 
+ * @param bitmap pointer to bitmap buffer
+ * @param bitmap_len length of `bitmap`, options beyond it are not selected
+ * 
+ * @return selected options
+ **/
+uint64_t bitmap_to_uint64(uint8_t *bitmap, size_t bitmap_len);
+
+/**
+ * @brief Store the first 64 options of a bitmap at once, option n is selected if bit n of `options` is set.
+ * 
+ * At most 8 bytes are written, options beyond them are unchanged.
+ * 
+ * @param options selected options
+ * @param bitmap pointer to bitmap buffer
+ * @param bitmap_len length of `bitmap`, bits of `options` beyond it are ignored
+ **/
+void uint64_to_bitmap(uint64_t options, uint8_t *bitmap, size_t bitmap_len);
+
+/**
+ * @brief Count the selected options of a bitmap, 64 options at a time.
+ * 
+ * @param bitmap pointer to bitmap buffer
+ * @param bitmap_len length of `bitmap`
+ * 
+ * @return number of set bits
+ **/
+size_t count_selected_options(uint8_t *bitmap, size_t bitmap_len);
+
+/**
+ * @brief Find the next selected option of a bitmap, skipping up to 64 unselected options at a time.
+ * 
+ * Iterate over all selected options with
+ * `for (size_t o = find_next_selected_option(b, len, 0); o < len * 8; o = find_next_selected_option(b, len, o + 1))`.
+ * 
+ * @param bitmap pointer to bitmap buffer
+ * @param bitmap_len length of `bitmap`
+ * @param start index of first option to check
+ * 
+ * @return index of the first selected option not before `start`, or `bitmap_len * 8` if there is none
+ **/
+size_t find_next_selected_option(uint8_t *bitmap, size_t bitmap_len, size_t start);
+
+/**
+ * @brief Set bit with index `option` in bitmap.
+ * 
+ * @param bitmap pointer to bitmap buffer
+ * @param bitmap_len length of `bitmap`, nothing is changed if `option` is beyond it
+ * @param option index of bit to set
+ **/
+void select_option(uint8_t *bitmap, size_t bitmap_len, uint8_t option);
+
+/**
+ * @brief Clear bit with index `option` in bitmap.
+ * 
+ * @param bitmap pointer to bitmap buffer
+ * @param bitmap_len length of `bitmap`, nothing is changed if `option` is beyond it
+ * @param option index of bit to clear
+ **/
+void deselect_option(uint8_t *bitmap, size_t bitmap_len, uint8_t option);
+
+/**
+ * @brief Limit a value to the range of `int32_t`.
+ **/
+static inline int32_t saturate_int32(int64_t val) {
+    if (val > INT32_MAX) {
+        return INT32_MAX;
+    }
+    if (val < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t) val;
+}
+
+/**
+ * @brief Add two values, limiting the result to the range of `int64_t`.
+ **/
+static inline int64_t saturate_add_int64(int64_t a, int64_t b) {
+    if (b > 0 && a > INT64_MAX - b) {
+        return INT64_MAX;
+    }
+    if (b < 0 && a < INT64_MIN - b) {
+        return INT64_MIN;
+    }
+    return a + b;
+}
+
+/**
+ * @brief Multiply two values, limiting the result to the range of `int64_t`.
+ **/
+static inline int64_t saturate_multiply_int64(int64_t a, int64_t b) {
+#if defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__))
+    int64_t product;
+    if (!__builtin_mul_overflow(a, b, &product)) {
+        return product;
+    }
+#else
+    uint8_t overflow;
+    if (a > 0) {
+        overflow = b > 0 ? a > INT64_MAX / b : b < INT64_MIN / a;
+    } else if (a < 0) {
+        overflow = b > 0 ? a < INT64_MIN / b : b != 0 && a < INT64_MAX / b;
+    } else {
+        overflow = 0;
+    }
+    if (!overflow) {
+        return a * b;
+    }
+#endif
+    return (a < 0) != (b < 0) ? INT64_MIN : INT64_MAX;
+}
+
+/**
+ * @brief Divide by a positive value, rounding half away from zero.
+ **/
+static inline int64_t divide_round_int64(int64_t val, int64_t divisor) {
+    int64_t quotient = val / divisor;
+    int64_t remainder = val % divisor;
+    if (remainder > 0 && remainder >= divisor - remainder) {
+        quotient++;
+    } else if (remainder < 0 && -remainder >= divisor + remainder) {
+        quotient--;
+    }
+    return quotient;
+}
+
+/**
+ * @brief Calculate `a * b / divisor` with a 128 bit intermediate product, rounding half away from zero.
+ *
+ * @param a first factor
+ * @param b second factor
+ * @param divisor positive divisor
+ *
+ * @return the quotient, limited to the range of `int64_t`
+ **/
+int64_t multiply_divide_int64(int64_t a, int64_t b, int64_t divisor);
+
+/**
+ * @brief Convert a fixed point value to another scale without converting it to floating point.
+ *
+ * Uses a table of powers of 10, digits removed are rounded half away from zero.
+ *
+ * @param val value to convert
+ * @param scale scale of result
+ *
+ * @return the converted value, `unscaled` is limited to the range of its type
+ **/
+fixp32 rescale_fixp32(fixp32 val, int32_t scale);
+fixp64 rescale_fixp64(fixp64 val, int32_t scale);
+
+/**
+ * @brief Add two fixed point values.
+ *
+ * @param a first summand, its scale is used for the result
+ * @param b second summand, converted to the scale of `a` before adding
+ *
+ * @return the sum, `unscaled` is limited to the range of its type
+ **/
+fixp32 add_fixp32(fixp32 a, fixp32 b);
+fixp64 add_fixp64(fixp64 a, fixp64 b);
+
+/**
+ * @brief Multiply two fixed point values without losing digits of the intermediate product.
+ *
+ * @param a first factor, its scale is used for the result
+ * @param b second factor
+ *
+ * @return the product rounded half away from zero, `unscaled` is limited to the range of its type
+ **/
+fixp32 multiply_fixp32(fixp32 a, fixp32 b);
+fixp64 multiply_fixp64(fixp64 a, fixp64 b);
+
+/**
+ * @brief Compare two fixed point values exactly, their scales may differ.
+ *
+ * @return -1 if `a < b`, 0 if `a == b` and 1 if `a > b`
+ **/
+int compare_fixp32(fixp32 a, fixp32 b);
+int compare_fixp64(fixp64 a, fixp64 b);
+
+/**
+ * @brief Get the unscaled value of a fixed point value in another scale, e.g. the whole number with scale 0.
+ *
+ * @param val value to convert
+ * @param scale scale of result
+ *
+ * @return the rounded value, limited to the range of its type
+ **/
+int32_t fixp32_to_int32(fixp32 val, int32_t scale);
+int64_t fixp64_to_int64(fixp64 val, int32_t scale);
+
+/**
+ * @brief Start a CRC-32 calculation matching the CRC32 digests of ROM blobs.
+ * 
+ * Data can be passed in arbitrary pieces with `crc32_update`, e.g. while reading it from flash.
+ * Uses a 1 KiB lookup table, define `EPUT_CRC32_SLICE_BY_8` to use 8 KiB of tables processing 8 bytes per step.
+ * The CRC32 instructions are used instead if the target supports them.
+ * 
+ * @param ctx pointer to context to initialize
+ **/
+void crc32_init(crc32_ctx *ctx);
+void crc32_update(crc32_ctx *ctx, uint8_t *data, size_t length);
+
+/**
+ * @brief Finish a CRC-32 calculation.
+ * 
+ * @param ctx pointer to context
+ * @param digest buffer of `CRC32_DIGEST_SIZE` bytes to store the big endian checksum to
+ **/
+void crc32_final(crc32_ctx *ctx, uint8_t *digest);
+
+/**
+ * @brief Start a SHA-256 calculation matching the SHA256 digests of ROM blobs.
+ * 
+ * Data can be passed in arbitrary pieces with `sha256_update`, e.g. while reading it from flash.
+ * The SHA-256 instructions are used if the target supports them.
+ * 
+ * @param ctx pointer to context to initialize
+ **/
+void sha256_init(sha256_ctx *ctx);
+void sha256_update(sha256_ctx *ctx, uint8_t *data, size_t length);
+
+/**
+ * @brief Finish a SHA-256 calculation.
+ * 
+ * @param ctx pointer to context
+ * @param digest buffer of `SHA256_DIGEST_SIZE` bytes to store the hash to
+ **/
+void sha256_final(sha256_ctx *ctx, uint8_t *digest);
+
+/**
+ * @brief Check data against the digest of its ROM blob descriptor.
+ * 
+ * @param data pointer to data
+ * @param length length of `data`
+ * @param digest pointer to expected digest
+ * @param digest_size size of `digest`, selects CRC-32 (4 bytes) or SHA-256 (32 bytes)
+ * 
+ * @return status code, `ERR_DIGEST_UNSUPPORTED` for other digest sizes
+ **/
+int verify_digest(uint8_t *data, size_t length, uint8_t *digest, uint8_t digest_size);
+
+/**
+ * @brief Calculate the ID of a preset dictionary, which is the Adler-32 checksum of the dictionary.
+ * 
+ * @param dictionary pointer to dictionary
+ * @param length length of `dictionary`
+ * 
+ * @return the dictionary ID
+ **/
+uint32_t get_dictionary_id(uint8_t *dictionary, size_t length);
+
+/**
+ * @brief Read the ID of the preset dictionary compressed metadata requires from its zlib header.
+ * 
+ * Metadata compressed with a dictionary can only be inflated after loading the dictionary with this ID,
+ * e.g. with `inflateSetDictionary`.
+ * 
+ * @param buf pointer to compressed metadata
+ * @param buf_len length of `buf`
+ * @param dictionary_id pointer to store the dictionary ID to, `ZLIB_NO_DICTIONARY` if none is required
+ * 
+ * @return status code, `ERR_ZLIB_HEADER_INVALID` if `buf` doesn't start with a valid zlib header
+ **/
+int get_zlib_dictionary_id(uint8_t *buf, size_t buf_len, uint32_t *dictionary_id);
+
+/**
+ * @brief Open the indexed translation section of metadata exported with indexed translations.
+ * 
+ * The section starts at the `translations_offset` of the exported JSON and ends with the metadata.
+ * Strings are looked up by the position of their ID in the descriptor, without reading other strings.
+ * 
+ * @param section pointer to translation section
+ * @param length length of `section`
+ * @param index pointer to translation index to initialize
+ * 
+ * @return status code, `ERR_TRANSLATIONS_INVALID` if `section` is no indexed translation section
+ **/
+int open_translations(uint8_t *section, size_t length, translation_index *index);
+
+/**
+ * @brief Find a language in an indexed translation section.
+ * 
+ * @param index pointer to translation index
+ * @param language language code, e.g. "en"
+ * @param language_index pointer to store the index of the language to
+ * 
+ * @return status code, `ERR_TRANSLATION_NOT_FOUND` if the language isn't included
+ **/
+int find_translation_language(translation_index *index, const char *language, uint8_t *language_index);
+
+/**
+ * @brief Get a single translated string from an indexed translation section.
+ * 
+ * @param index pointer to translation index
+ * @param language_index index of language, see `find_translation_language`
+ * @param id_index position of the ID in the descriptor
+ * @param text pointer to store pointer to NUL-terminated UTF-8 string to, empty if not translated
+ * 
+ * @return status code, `ERR_TRANSLATION_NOT_FOUND` if an index is out of range
+ **/
+int get_translation(translation_index *index, uint8_t language_index, uint32_t id_index, const char **text);
+
+/**
+ * @brief Open a ROM blob in place, e.g. in memory-mapped (XIP) flash or a file mapped with `mmap`.
+ * 
+ * All descriptors are checked against `length`, entries can be accessed afterwards without further checks.
+ * 
+ * @param blob pointer to ROM blob
+ * @param length length of `blob`
+ * @param rom pointer to ROM blob to initialize
+ * 
+ * @return status code, `ERR_ROM_BLOB_INVALID` if header or descriptors don't fit into `blob`
+ **/
+int open_rom_blob(uint8_t *blob, size_t length, rom_blob *rom);
+
+/**
+ * @brief Get a blob of a ROM blob, index 0 is the data blob followed by the metadata sets.
+ * 
+ * @param rom pointer to opened ROM blob
+ * @param index index of the blob
+ * @param entry pointer to store view of the blob to, pointing into the ROM blob
+ * 
+ * @return status code, `ERR_ROM_BLOB_NOT_FOUND` if the index is out of range
+ **/
+int get_rom_blob_entry(rom_blob *rom, uint8_t index, rom_blob_entry *entry);
+
+/**
+ * @brief Get the data blob of a ROM blob.
+ * 
+ * @param rom pointer to opened ROM blob
+ * @param entry pointer to store view of the data blob to
+ * 
+ * @return status code
+ **/
+int get_rom_blob_data(rom_blob *rom, rom_blob_entry *entry);
+
+/**
+ * @brief Get the metadata of a translation set of a ROM blob.
+ * 
+ * @param rom pointer to opened ROM blob
+ * @param translation_set index of the translation set in the order passed to the generator
+ * @param entry pointer to store view of the metadata to
+ * 
+ * @return status code, `ERR_ROM_BLOB_NOT_FOUND` if there is no such translation set
+ **/
+int get_rom_blob_metadata(rom_blob *rom, uint8_t translation_set, rom_blob_entry *entry);
+
+/**
+ * @brief Check a blob of a ROM blob against the digest in its descriptor.
+ * 
+ * @param rom pointer to opened ROM blob
+ * @param entry pointer to blob
+ * 
+ * @return status code, `ERR_DIGEST_UNSUPPORTED` for ROM blobs not using CRC-32 or SHA-256
+ **/
+int verify_rom_blob_entry(rom_blob *rom, rom_blob_entry *entry);
+
+/**
+ * @brief Calculate a fast non-cryptographic hash, e.g. to look up payloads in a cache.
+ * 
+ * Reads 8 bytes at a time. Hashes differ between targets of different byte order, so don't store or transmit them.
+ * 
+ * @param data pointer to data
+ * @param length length of `data`
+ * 
+ * @return the hash
+ **/
+uint64_t hash_bytes(uint8_t *data, size_t length);
+
+#ifdef EPUT_TRACE
+// Cycle counter of the DWT on Cortex-M is 32 bits wide, differences stay correct across one wrap
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+typedef uint32_t trace_ticks;
+#else
+typedef uint64_t trace_ticks;
+#endif
+
+// Accumulated measurements of one trace point
+typedef struct {
+    uint32_t calls;
+    uint64_t ticks;
+    trace_ticks max_ticks;
+    uint64_t bytes;
+} trace_stat;
+
+/**
+ * @brief Enable the cycle counter and reset all measurements.
+ * 
+ * Only needed once on Cortex-M, where the DWT cycle counter is disabled after reset.
+ **/
+void init_trace(void);
+
+/**
+ * @brief Get the current value of the clock used for tracing.
+ * 
+ * Counts CPU cycles on Cortex-M (DWT CYCCNT) and x86 (TSC), nanoseconds of `timespec_get` otherwise.
+ * 
+ * @return current ticks
+ **/
+trace_ticks get_trace_ticks(void);
+
+/**
+ * @brief Add a measurement to a trace point, used by `EPUT_TRACE_END`.
+ * 
+ * Not thread-safe, measurements from concurrent calls may be lost.
+ * 
+ * @param point one of `EPUT_TRACE_*`, ignored if out of range
+ * @param ticks elapsed ticks
+ * @param bytes number of bytes processed
+ **/
+void record_trace(uint8_t point, trace_ticks ticks, size_t bytes);
+
+/**
+ * @brief Get the accumulated measurements of a trace point, e.g. to report them as telemetry.
+ * 
+ * @param point one of `EPUT_TRACE_*`
+ * @param stat pointer to struct the measurements are copied to
+ * 
+ * @return status code
+ **/
+int get_trace_stat(uint8_t point, trace_stat *stat);
+
+/**
+ * @brief Reset the measurements of all trace points.
+ **/
+void reset_trace_stats(void);
+
+#define EPUT_TRACE_BEGIN(point) trace_ticks eput_trace_start_##point = get_trace_ticks()
+#define EPUT_TRACE_END(point, bytes) record_trace((point), (trace_ticks) (get_trace_ticks() - eput_trace_start_##point), (bytes))
+#else
+// Tracing is disabled unless `EPUT_TRACE` is defined, hooks compile to nothing
+#define EPUT_TRACE_BEGIN(point)
+#define EPUT_TRACE_END(point, bytes) ((void) 0)
+#endif
+
 #endif
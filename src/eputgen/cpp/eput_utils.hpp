@@ -0,0 +1,736 @@
+#ifndef EPUT_UTILS_HPP
+#define EPUT_UTILS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define EPUT_HAS_MMAP
+#endif
+
+namespace eput {
+
+constexpr std::uint8_t TLV_TYPE_NULL = 0x00;
+constexpr std::uint8_t TLV_TYPE_TERMINATOR = 0xFE;
+constexpr std::uint8_t TLV_TYPE_NDEF = 0x03;
+
+constexpr std::uint8_t TNF_URI = 0x03;
+inline constexpr char RECORD_TYPE_SCHEME[] = "https://pma.inftech.hs-mannheim.de/eput";
+constexpr std::size_t RECORD_TYPE_SCHEME_LENGTH = sizeof(RECORD_TYPE_SCHEME) - 1;
+
+constexpr int SUCCESS = 0;
+constexpr int ERR_NO_NDEF_TLV = -10;
+constexpr int ERR_REC_BUF_TRUNCATED = -20;
+constexpr int ERR_REC_WRONG_TYPE = -21;
+constexpr int ERR_DATA_BUF_WRONG_LENGTH = -30;
+constexpr int ERR_ZLIB_HEADER_INVALID = -60;
+constexpr int ERR_ROM_BLOB_INVALID = -80;
+constexpr int ERR_ROM_BLOB_NOT_FOUND = -81;
+constexpr int ERR_ROM_BLOB_MAP_FAILED = -82;
+
+constexpr std::uint32_t ZLIB_NO_DICTIONARY = 0;
+
+/**
+ * @brief Non-owning view of contiguous memory.
+ *
+ * Subset of `std::span`, which is not available before C++20.
+ **/
+template <typename T>
+class span {
+public:
+    constexpr span() noexcept : data_(nullptr), size_(0) {}
+
+    constexpr span(T *data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+    template <std::size_t N>
+    constexpr span(T (&arr)[N]) noexcept : data_(arr), size_(N) {}
+
+    // Containers with contiguous storage like `std::vector` or `std::array`
+    template <
+        typename Container,
+        typename = std::enable_if_t<std::is_convertible<decltype(std::declval<Container &>().data()), T *>::value>>
+    constexpr span(Container &container) noexcept : data_(container.data()), size_(container.size()) {}
+
+    // Conversion from mutable to const view
+    template <typename U, typename = std::enable_if_t<std::is_convertible<U (*)[], T (*)[]>::value>>
+    constexpr span(const span<U> &other) noexcept : data_(other.data()), size_(other.size()) {}
+
+    constexpr T *data() const noexcept {
+        return data_;
+    }
+
+    constexpr std::size_t size() const noexcept {
+        return size_;
+    }
+
+    constexpr T &operator[](std::size_t index) const noexcept {
+        return data_[index];
+    }
+
+    constexpr T *begin() const noexcept {
+        return data_;
+    }
+
+    constexpr T *end() const noexcept {
+        return data_ + size_;
+    }
+
+    constexpr span subspan(std::size_t offset) const noexcept {
+        return span(data_ + offset, size_ - offset);
+    }
+
+    constexpr span subspan(std::size_t offset, std::size_t count) const noexcept {
+        return span(data_ + offset, count);
+    }
+
+private:
+    T *data_;
+    std::size_t size_;
+};
+
+using time_point = std::int64_t;
+using zone_offset = std::int16_t;
+
+struct zoned_time {
+    time_point time;
+    zone_offset offset;
+};
+
+struct hh_mm_ss {
+    std::uint8_t hours;
+    std::uint8_t minutes;
+    std::uint8_t seconds;
+};
+
+struct time_range {
+    hh_mm_ss from;
+    hh_mm_ss to;
+};
+
+struct date_range {
+    time_point from;
+    time_point to;
+};
+
+// val = unscaled * 10 ^ -scale
+template <typename T>
+struct fixed_point {
+    T unscaled;
+    std::int32_t scale;
+};
+
+using fixp32 = fixed_point<std::int32_t>;
+using fixp64 = fixed_point<std::int64_t>;
+
+/**
+ * @brief Conversion of values from and to their big endian representation in the payload.
+ **/
+template <typename T, typename Enable = void>
+struct codec;
+
+// Optimizing compilers turn the byte loops into a single load or store and a byte swap
+template <typename T>
+struct codec<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>> {
+    static constexpr std::size_t size = sizeof(T);
+
+    static T decode(const std::uint8_t *bytes) noexcept {
+        using U = std::make_unsigned_t<T>;
+        U val = 0;
+        for (std::size_t i = 0; i < sizeof(T); i++) {
+            val = static_cast<U>((val << 8) | bytes[i]);
+        }
+        return static_cast<T>(val);
+    }
+
+    static void encode(const T &val, std::uint8_t *bytes) noexcept {
+        using U = std::make_unsigned_t<T>;
+        U uval = static_cast<U>(val);
+        for (std::size_t i = 0; i < sizeof(T); i++) {
+            bytes[sizeof(T) - 1 - i] = static_cast<std::uint8_t>(uval >> (8 * i));
+        }
+    }
+};
+
+template <>
+struct codec<bool> {
+    static constexpr std::size_t size = 1;
+
+    static bool decode(const std::uint8_t *bytes) noexcept {
+        return bytes[0] != 0;
+    }
+
+    static void encode(const bool &val, std::uint8_t *bytes) noexcept {
+        bytes[0] = val ? 1 : 0;
+    }
+};
+
+template <typename T>
+struct codec<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only IEEE 754 single and double precision are supported");
+    using bits = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+    static constexpr std::size_t size = sizeof(T);
+
+    static T decode(const std::uint8_t *bytes) noexcept {
+        bits raw = codec<bits>::decode(bytes);
+        T val;
+        std::memcpy(&val, &raw, sizeof(T));
+        return val;
+    }
+
+    static void encode(const T &val, std::uint8_t *bytes) noexcept {
+        bits raw;
+        std::memcpy(&raw, &val, sizeof(T));
+        codec<bits>::encode(raw, bytes);
+    }
+};
+
+// Bitmaps, copied as they are
+template <std::size_t N>
+struct codec<std::array<std::uint8_t, N>> {
+    static constexpr std::size_t size = N;
+
+    static std::array<std::uint8_t, N> decode(const std::uint8_t *bytes) noexcept {
+        std::array<std::uint8_t, N> val;
+        std::memcpy(val.data(), bytes, N);
+        return val;
+    }
+
+    static void encode(const std::array<std::uint8_t, N> &val, std::uint8_t *bytes) noexcept {
+        std::memcpy(bytes, val.data(), N);
+    }
+};
+
+template <>
+struct codec<hh_mm_ss> {
+    static constexpr std::size_t size = 3;
+
+    static hh_mm_ss decode(const std::uint8_t *bytes) noexcept {
+        return {bytes[0], bytes[1], bytes[2]};
+    }
+
+    static void encode(const hh_mm_ss &val, std::uint8_t *bytes) noexcept {
+        bytes[0] = val.hours;
+        bytes[1] = val.minutes;
+        bytes[2] = val.seconds;
+    }
+};
+
+template <>
+struct codec<zoned_time> {
+    static constexpr std::size_t size = 10;
+
+    static zoned_time decode(const std::uint8_t *bytes) noexcept {
+        return {codec<time_point>::decode(bytes), codec<zone_offset>::decode(bytes + 8)};
+    }
+
+    static void encode(const zoned_time &val, std::uint8_t *bytes) noexcept {
+        codec<time_point>::encode(val.time, bytes);
+        codec<zone_offset>::encode(val.offset, bytes + 8);
+    }
+};
+
+template <>
+struct codec<date_range> {
+    static constexpr std::size_t size = 16;
+
+    static date_range decode(const std::uint8_t *bytes) noexcept {
+        return {codec<time_point>::decode(bytes), codec<time_point>::decode(bytes + 8)};
+    }
+
+    static void encode(const date_range &val, std::uint8_t *bytes) noexcept {
+        codec<time_point>::encode(val.from, bytes);
+        codec<time_point>::encode(val.to, bytes + 8);
+    }
+};
+
+template <>
+struct codec<time_range> {
+    static constexpr std::size_t size = 6;
+
+    static time_range decode(const std::uint8_t *bytes) noexcept {
+        return {codec<hh_mm_ss>::decode(bytes), codec<hh_mm_ss>::decode(bytes + 3)};
+    }
+
+    static void encode(const time_range &val, std::uint8_t *bytes) noexcept {
+        codec<hh_mm_ss>::encode(val.from, bytes);
+        codec<hh_mm_ss>::encode(val.to, bytes + 3);
+    }
+};
+
+/**
+ * @brief Limits of a numeric property.
+ **/
+template <typename T>
+struct limits {
+    bool has_min;
+    T min_value;
+    bool has_max;
+    T max_value;
+    bool has_step;
+    T step_size;
+
+    // Limit value to the range between min and max like the safe getters of the C library
+    constexpr T clamp(T val) const noexcept {
+        if (has_min && val < min_value) {
+            return min_value;
+        }
+        if (has_max && val > max_value) {
+            return max_value;
+        }
+        return val;
+    }
+};
+
+/**
+ * @brief Descriptor of a property of type `T` at `Offset` in the payload.
+ **/
+template <std::size_t Offset, typename T>
+struct field {
+    using type = T;
+    static constexpr std::size_t offset = Offset;
+    static constexpr std::size_t size = codec<T>::size;
+
+    static T decode(span<const std::uint8_t> payload) noexcept {
+        return codec<T>::decode(payload.data() + Offset);
+    }
+
+    static void encode(const T &val, span<std::uint8_t> payload) noexcept {
+        codec<T>::encode(val, payload.data() + Offset);
+    }
+};
+
+/**
+ * @brief Descriptor of a string property with `Length` bytes in the payload.
+ *
+ * Decoded strings are stored with an additional terminating NUL byte.
+ **/
+template <std::size_t Offset, std::size_t Length>
+struct string_field {
+    using type = std::array<std::uint8_t, Length + 1>;
+    static constexpr std::size_t offset = Offset;
+    static constexpr std::size_t size = Length;
+
+    static type decode(span<const std::uint8_t> payload) noexcept {
+        type val;
+        std::memcpy(val.data(), payload.data() + Offset, Length);
+        val[Length] = 0;
+        return val;
+    }
+
+    static void encode(const type &val, span<std::uint8_t> payload) noexcept {
+        std::memcpy(payload.data() + Offset, val.data(), Length);
+    }
+};
+
+/**
+ * @brief Descriptor of a fixed point property storing unscaled values of type `T`.
+ **/
+template <std::size_t Offset, typename T, std::int32_t Scale>
+struct fixed_point_field {
+    using type = fixed_point<T>;
+    static constexpr std::size_t offset = Offset;
+    static constexpr std::size_t size = sizeof(T);
+    static constexpr std::int32_t scale = Scale;
+
+    static type decode(span<const std::uint8_t> payload) noexcept {
+        return {codec<T>::decode(payload.data() + Offset), Scale};
+    }
+
+    static void encode(const type &val, span<std::uint8_t> payload) noexcept {
+        codec<T>::encode(val.unscaled, payload.data() + Offset);
+    }
+};
+
+/**
+ * @brief Descriptor of the `Size` bytes of a bit field property, its properties are described by `bit_field`.
+ **/
+template <std::size_t Offset, std::size_t Size>
+struct bit_field_bytes {
+    static constexpr std::size_t offset = Offset;
+    static constexpr std::size_t size = Size;
+
+    static void clear(span<std::uint8_t> payload) noexcept {
+        std::memset(payload.data() + Offset, 0, Size);
+    }
+};
+
+/**
+ * @brief Descriptor of a bool or selection packed into `Width` bits, starting at bit `Bit` of a bit field at `Offset`.
+ *
+ * Bit n is bit n % 8 of byte n / 8. Encoding keeps the other bits of the bit field.
+ **/
+template <std::size_t Offset, std::size_t Bit, std::size_t Width, typename T>
+struct bit_field {
+    static_assert(Width > 0 && Width <= 8, "bit fields hold at most 8 bits per property");
+    using type = T;
+    static constexpr std::size_t offset = Offset;
+    static constexpr std::size_t bit = Bit;
+    static constexpr std::size_t width = Width;
+    static constexpr unsigned int mask = (1u << Width) - 1u;
+    static constexpr unsigned int shift = Bit % 8;
+    static constexpr bool straddles = shift + Width > 8;
+
+    static T decode(span<const std::uint8_t> payload) noexcept {
+        const std::uint8_t *bytes = payload.data() + Offset + Bit / 8;
+        unsigned int word = bytes[0];
+        if (straddles) {
+            word |= static_cast<unsigned int>(bytes[1]) << 8;
+        }
+        return static_cast<T>((word >> shift) & mask);
+    }
+
+    static void encode(const T &val, span<std::uint8_t> payload) noexcept {
+        std::uint8_t *bytes = payload.data() + Offset + Bit / 8;
+        unsigned int bits = (static_cast<unsigned int>(val) & mask) << shift;
+        unsigned int kept = ~(mask << shift);
+        bytes[0] = static_cast<std::uint8_t>((bytes[0] & kept) | bits);
+        if (straddles) {
+            bytes[1] = static_cast<std::uint8_t>((bytes[1] & (kept >> 8)) | (bits >> 8));
+        }
+    }
+};
+
+/**
+ * @brief Descriptor of an array property with `Count` entries of `EntrySize` bytes.
+ *
+ * Offsets of the properties in an entry are relative to the start of the entry.
+ **/
+template <std::size_t Offset, std::size_t EntrySize, std::size_t Count>
+struct array_field {
+    static constexpr std::size_t offset = Offset;
+    static constexpr std::size_t entry_size = EntrySize;
+    static constexpr std::size_t count = Count;
+    static constexpr std::size_t size = EntrySize * Count;
+
+    template <typename T>
+    static constexpr span<T> entry(span<T> payload, std::size_t index) noexcept {
+        return payload.subspan(Offset + index * EntrySize, EntrySize);
+    }
+};
+
+struct ndef_record {
+    std::uint8_t tnf;
+    span<const std::uint8_t> type;
+    span<const std::uint8_t> id;
+    span<const std::uint8_t> payload;
+};
+
+/**
+ * @brief Find the value of the first NDEF TLV in NFC memory.
+ *
+ * Scans like `get_ndef_tlv_offset` of the C utilities: stops at the first NDEF TLV, a terminator TLV
+ * or a TLV with the reserved length 0xFFFF.
+ *
+ * @param memory contents of NFC memory
+ * @param message span to store the NDEF message to
+ *
+ * @return status code
+ **/
+inline int find_ndef_message(span<const std::uint8_t> memory, span<const std::uint8_t> &message) noexcept {
+    std::size_t index = 0;
+    while (index < memory.size()) {
+        std::uint8_t type = memory[index];
+        if (type == TLV_TYPE_NULL) {
+            index++;
+            continue;
+        } else if (type == TLV_TYPE_TERMINATOR || index + 1 >= memory.size()) {
+            break;
+        }
+        std::size_t length = memory[index + 1];
+        std::size_t value_offset = index + 2;
+        if (length == 0xFF) {
+            if (index + 3 >= memory.size()) {
+                break;
+            }
+            length = (static_cast<std::size_t>(memory[index + 2]) << 8) | memory[index + 3];
+            value_offset = index + 4;
+            if (length == 0xFFFF) {
+                // Value is reserved - treat as invalid
+                break;
+            }
+        }
+        if (value_offset + length > memory.size()) {
+            break;
+        }
+        if (type == TLV_TYPE_NDEF) {
+            if (length == 0) {
+                break;
+            }
+            message = memory.subspan(value_offset, length);
+            return SUCCESS;
+        }
+        index = value_offset + length;
+    }
+    return ERR_NO_NDEF_TLV;
+}
+
+/**
+ * @brief Extract NDEF record contents, assuming `buf` starts with the record.
+ *
+ * @param buf NDEF record buffer
+ * @param record reference to store record to
+ *
+ * @return length of extracted record in `buf` if bigger than 0, otherwise error code
+ **/
+inline int get_record(span<const std::uint8_t> buf, ndef_record &record) noexcept {
+    if (buf.size() < 2) {
+        return ERR_REC_BUF_TRUNCATED;
+    }
+    std::uint8_t flags = buf[0];
+    std::size_t pl_length = (flags & 0x10) != 0 ? 1 : 4;
+    std::size_t idl_length = (flags & 0x08) != 0 ? 1 : 0;
+    std::size_t header_length = 2 + pl_length + idl_length;
+    if (buf.size() < header_length) {
+        return ERR_REC_BUF_TRUNCATED;
+    }
+    std::size_t type_length = buf[1];
+    std::size_t payload_length = pl_length == 1 ? buf[2] : codec<std::uint32_t>::decode(buf.data() + 2);
+    std::size_t id_length = idl_length > 0 ? buf[2 + pl_length] : 0;
+    if (buf.size() - header_length < type_length + id_length
+            || buf.size() - header_length - type_length - id_length < payload_length) {
+        return ERR_REC_BUF_TRUNCATED;
+    }
+    record.tnf = flags & 0x07;
+    record.type = buf.subspan(header_length, type_length);
+    record.id = buf.subspan(header_length + type_length, id_length);
+    record.payload = buf.subspan(header_length + type_length + id_length, payload_length);
+    return static_cast<int>(header_length + type_length + id_length + payload_length);
+}
+
+inline bool type_valid(span<const std::uint8_t> type) noexcept {
+    return type.size() >= RECORD_TYPE_SCHEME_LENGTH
+        && std::memcmp(type.data(), RECORD_TYPE_SCHEME, RECORD_TYPE_SCHEME_LENGTH) == 0;
+}
+
+/**
+ * @brief Extract only the data record from NDEF message.
+ *
+ * @param message NDEF message buffer
+ * @param data_rec reference to store data record to
+ *
+ * @return length of data record in `message` if bigger than 0, otherwise error code
+ **/
+inline int get_data_record(span<const std::uint8_t> message, ndef_record &data_rec) noexcept {
+    int ret = get_record(message, data_rec);
+    if (ret < 0) {
+        return ret;
+    } else if (data_rec.tnf != TNF_URI || !type_valid(data_rec.type)) {
+        return ERR_REC_WRONG_TYPE;
+    }
+    return ret;
+}
+
+/**
+ * @brief Calculate the ID of a preset dictionary, which is the Adler-32 checksum of the dictionary.
+ *
+ * @param dictionary dictionary buffer
+ *
+ * @return the dictionary ID
+ **/
+constexpr std::uint32_t get_dictionary_id(span<const std::uint8_t> dictionary) noexcept {
+    std::uint32_t a = 1;
+    std::uint32_t b = 0;
+    for (std::size_t i = 0; i < dictionary.size(); i++) {
+        a = (a + dictionary[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return (b << 16) | a;
+}
+
+/**
+ * @brief Read the ID of the preset dictionary compressed metadata requires from its zlib header.
+ *
+ * @param buf compressed metadata buffer
+ * @param dictionary_id reference to store the dictionary ID to, `ZLIB_NO_DICTIONARY` if none is required
+ *
+ * @return status code, `ERR_ZLIB_HEADER_INVALID` if `buf` doesn't start with a valid zlib header
+ **/
+inline int get_zlib_dictionary_id(span<const std::uint8_t> buf, std::uint32_t &dictionary_id) noexcept {
+    if (buf.size() < 2) {
+        return ERR_ZLIB_HEADER_INVALID;
+    }
+    std::uint8_t cmf = buf[0];
+    std::uint8_t flg = buf[1];
+    if ((cmf & 0x0F) != 8 || (cmf >> 4) > 7 || ((cmf << 8) | flg) % 31 != 0) {
+        return ERR_ZLIB_HEADER_INVALID;
+    }
+    if ((flg & 0x20) == 0) {
+        dictionary_id = ZLIB_NO_DICTIONARY;
+        return SUCCESS;
+    }
+    if (buf.size() < 6) {
+        return ERR_ZLIB_HEADER_INVALID;
+    }
+    dictionary_id = codec<std::uint32_t>::decode(buf.data() + 2);
+    return SUCCESS;
+}
+
+// Zero-copy view of a single blob inside a ROM blob
+struct rom_blob_entry {
+    span<const std::uint8_t> digest;
+    span<const std::uint8_t> data;
+};
+
+/**
+ * @brief ROM blob exported by eputgen, read in place from flash or a mapped file.
+ *
+ * Index 0 is the data blob, followed by one metadata blob per translation set.
+ **/
+class rom_blob {
+public:
+    /**
+     * @brief Open a ROM blob, checking all descriptors against the size of `blob`.
+     *
+     * @param blob ROM blob buffer, must outlive `rom`
+     * @param rom reference to store ROM blob to
+     *
+     * @return status code, `ERR_ROM_BLOB_INVALID` if header or descriptors don't fit into `blob`
+     **/
+    static int open(span<const std::uint8_t> blob, rom_blob &rom) noexcept {
+        if (blob.size() < 2 || blob[0] == 0) {
+            return ERR_ROM_BLOB_INVALID;
+        }
+        std::size_t count = blob[0];
+        std::size_t descriptor_size = static_cast<std::size_t>(blob[1]) + 8;
+        if ((blob.size() - 2) / descriptor_size < count) {
+            return ERR_ROM_BLOB_INVALID;
+        }
+        for (std::size_t i = 0; i < count; i++) {
+            const std::uint8_t *descriptor = blob.data() + 2 + i * descriptor_size + blob[1];
+            std::uint32_t start = codec<std::uint32_t>::decode(descriptor);
+            std::uint32_t length = codec<std::uint32_t>::decode(descriptor + 4);
+            if (start > blob.size() || blob.size() - start < length) {
+                return ERR_ROM_BLOB_INVALID;
+            }
+        }
+        rom.blob_ = blob;
+        return SUCCESS;
+    }
+
+    std::size_t count() const noexcept {
+        return blob_.size() > 0 ? blob_[0] : 0;
+    }
+
+    std::size_t digest_size() const noexcept {
+        return blob_.size() > 0 ? blob_[1] : 0;
+    }
+
+    /**
+     * @brief Get a blob by index.
+     *
+     * @param index index of the blob
+     * @param entry reference to store view of the blob to
+     *
+     * @return status code, `ERR_ROM_BLOB_NOT_FOUND` if the index is out of range
+     **/
+    int entry(std::size_t index, rom_blob_entry &entry) const noexcept {
+        if (index >= count()) {
+            return ERR_ROM_BLOB_NOT_FOUND;
+        }
+        span<const std::uint8_t> descriptor = blob_.subspan(2 + index * (digest_size() + 8), digest_size() + 8);
+        entry.digest = descriptor.subspan(0, digest_size());
+        entry.data = blob_.subspan(
+            codec<std::uint32_t>::decode(descriptor.data() + digest_size()),
+            codec<std::uint32_t>::decode(descriptor.data() + digest_size() + 4));
+        return SUCCESS;
+    }
+
+    int data(rom_blob_entry &entry) const noexcept {
+        return this->entry(0, entry);
+    }
+
+    int metadata(std::size_t translation_set, rom_blob_entry &entry) const noexcept {
+        return this->entry(translation_set + 1, entry);
+    }
+
+private:
+    span<const std::uint8_t> blob_;
+};
+
+#ifdef EPUT_HAS_MMAP
+/**
+ * @brief Read-only memory mapping of a file, e.g. a ROM blob on the host.
+ *
+ * Pages are loaded on first access, so opening even large files is instant.
+ **/
+class mapped_file {
+public:
+    mapped_file() noexcept = default;
+
+    mapped_file(const mapped_file &) = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+
+    mapped_file(mapped_file &&other) noexcept
+        : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+    mapped_file &operator=(mapped_file &&other) noexcept {
+        if (this != &other) {
+            close();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    ~mapped_file() {
+        close();
+    }
+
+    /**
+     * @brief Map a file, replacing the current mapping.
+     *
+     * @param path path of the file
+     *
+     * @return status code, `ERR_ROM_BLOB_MAP_FAILED` if the file can't be opened or is empty
+     **/
+    int open(const char *path) noexcept {
+        close();
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return ERR_ROM_BLOB_MAP_FAILED;
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return ERR_ROM_BLOB_MAP_FAILED;
+        }
+        void *mapping = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping stays valid after closing the descriptor
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            return ERR_ROM_BLOB_MAP_FAILED;
+        }
+        data_ = static_cast<const std::uint8_t *>(mapping);
+        size_ = static_cast<std::size_t>(info.st_size);
+        return SUCCESS;
+    }
+
+    void close() noexcept {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<std::uint8_t *>(data_), size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    span<const std::uint8_t> bytes() const noexcept {
+        return span<const std::uint8_t>(data_, size_);
+    }
+
+private:
+    const std::uint8_t *data_ = nullptr;
+    std::size_t size_ = 0;
+};
+#endif
+
+}
+
+#endif
@@ -4,12 +4,19 @@
 import hashlib
 import json
 import base64
+import os
+import shutil
+from concurrent.futures import ProcessPoolExecutor
 from os import sep
+from pathlib import Path
 import zlib
-from .yaml_parser import get_device_info, get_properties, get_ids, parse
-from .blob_generator import generate_metadata, generate_data
-from .lib_generator import generate_lib_header, generate_lib_code, copy_utils, H_FILENAME_TEMPLATE, C_FILENAME_TEMPLATE
-from .util import error, generate_device_id, warn
+from .yaml_parser import compile_descriptor, read_descriptor
+from .blob_generator import generate_metadata, generate_data, serialize_metadata, train_dictionary, get_dictionary_id
+from .blob_generator import DICTIONARY_SIZE, get_translations_offset
+from .lib_generator import generate_lib_header, generate_lib_code, generate_layout_header, generate_lib_cpp_header
+from .lib_generator import copy_utils, copy_cpp_utils
+from .lib_generator import H_FILENAME_TEMPLATE, C_FILENAME_TEMPLATE, HPP_LAYOUT_FILENAME_TEMPLATE, HPP_FILENAME_TEMPLATE
+from .util import error, generator_fingerprint, warn
 
 class CRC32Hash:
     @property
@@ -22,7 +29,7 @@ class CRC32Hash:
 
     @property
     def name(self) -> str:
-        return "md5"
+        return "crc32"
 
     def __init__(self, data=None) -> None:
         self._result = 0
@@ -68,10 +75,18 @@ def export_rom_blob(
         translation_sets,
         compress_metadata,
         hash_func,
-        tag_size=-1) -> None:
+        tag_size=-1,
+        dictionary=None,
+        indexed_translations=False,
+        schema_cache=None) -> None:
     """Export a blob containing data and metadata.
     If translation_sets is None, only one set will be included with all translations contained in the main configuration file.
     Otherwise translations in the main configuration file will be ignored.
+    The blob starts with the number of blobs and the digest size as single bytes, followed by a descriptor
+    per blob containing its digest, start address and length. Addresses and lengths are 4 byte big-endian,
+    addresses are offsets from the start of the ROM blob. The data blob comes first, then one metadata
+    blob per translation set. Identical blobs are stored once and their descriptors share the start address.
+    See open_rom_blob in the utility library for a reader.
 
     Args:
         config_file (str): the file to read the YAML configuration definition from
@@ -80,50 +95,118 @@ def export_rom_blob(
         compress_metadata (bool): compress metadata with deflate
         hash_func: The hash function to use (one of HASH_MD5, HASH_SHA1, HASH_SHA256, HASH_CRC32)
         tag_size (int): memory size of used tag
+        dictionary (bytes): preset dictionary to compress metadata with, see export_dictionary
+        indexed_translations (bool): serialize translations with offset tables for lookups of single strings
+        schema_cache (str): folder to cache compiled descriptors in, see compile_descriptor
     """
 
-    doc = parse(config_file)
-    props = get_properties(doc)
-    ids = get_ids(doc)
-    dev_info = get_device_info(doc)
-    data = generate_data(props)
+    blobs = _generate_rom_blobs(config_file, translation_sets, compress_metadata, tag_size, dictionary, indexed_translations, schema_cache)
+    if not output_path.endswith(sep):
+        output_path = output_path + sep
+    blob_file = output_path + "rom_blob.bin"
+    with open(blob_file, "wb") as file:
+        file.write(_create_rom_blob(blobs, hash_func))
+
+ROM_BLOB_HEADER_SIZE = 2
+ROM_BLOB_MAX_COUNT = 255
+
+def export_rom_image(
+        config_files,
+        output_path,
+        translation_sets,
+        compress_metadata,
+        hash_func,
+        tag_size=-1,
+        dictionary=None,
+        indexed_translations=False,
+        schema_cache=None) -> int:
+    """Export a combined ROM image with data and metadata of many descriptors, e.g. one per product variant.
+    The image has the layout of export_rom_blob. Each descriptor contributes its data blob followed by one
+    metadata blob per translation set, so the blobs of the n-th descriptor start at index n * (1 + number of sets).
+    Identical blobs, e.g. metadata of variants only differing in their defaults, are stored once and their
+    descriptors share the start address.
+
+    Args:
+        config_files (list): the files to read the YAML configuration definitions from
+        output_path (str): folder to write output file to
+        translation_sets (list): a list of lists, that contain the languages to be included in each metadata set.
+        compress_metadata (bool): compress metadata with deflate
+        hash_func: The hash function to use (one of HASH_MD5, HASH_SHA1, HASH_SHA256, HASH_CRC32)
+        tag_size (int): memory size of used tag
+        dictionary (bytes): preset dictionary to compress metadata with, see export_dictionary
+        indexed_translations (bool): serialize translations with offset tables for lookups of single strings
+        schema_cache (str): folder to cache compiled descriptors in, see compile_descriptor
+
+    Returns:
+        int: number of bytes saved by storing identical blobs once
+    """
+
+    blobs = []
+    for config_file in config_files:
+        blobs.extend(_generate_rom_blobs(config_file, translation_sets, compress_metadata, tag_size, dictionary, indexed_translations, schema_cache))
+    if len(blobs) > ROM_BLOB_MAX_COUNT:
+        error(None, f"ROM image would contain {len(blobs)} blobs, at most {ROM_BLOB_MAX_COUNT} are supported.")
+    image = _create_rom_blob(blobs, hash_func)
+    if not output_path.endswith(sep):
+        output_path = output_path + sep
+    with open(output_path + "rom_image.bin", "wb") as file:
+        file.write(image)
+    return ROM_BLOB_HEADER_SIZE + len(blobs) * (8 + hash_func.digest_size) + sum(map(len, blobs)) - len(image)
+
+def _generate_rom_blobs(config_file, translation_sets, compress_metadata, tag_size, dictionary, indexed_translations, schema_cache) -> list:
+    compiled = compile_descriptor(config_file, schema_cache)
+    data = generate_data(compiled.properties)
     metadata_sets = []
     if translation_sets is None:
-        translation_data = None
-        if "translation_data" in doc:
-            translation_data = doc["translation_data"]
-        metadata = generate_metadata(dev_info, ids, props, translation_data, compress_metadata)
-        metadata_sets.append(metadata)
+        metadata_sets.append(_generate_compiled_metadata(compiled, compiled.translations, compress_metadata, dictionary, indexed_translations))
     else:
-        if "translation_data" in doc:
-            translations = {translation["language"]: translation for translation in doc["translation_data"]}
+        if compiled.translations is not None:
+            translations = {translation["language"]: translation for translation in compiled.translations}
             for trans_set in translation_sets:
                 used_translations = [v for k, v in translations.items() if k in trans_set]
-                metadata = generate_metadata(dev_info, ids, props, used_translations, compress_metadata)
-                metadata_sets.append(metadata)
+                metadata_sets.append(_generate_compiled_metadata(compiled, used_translations, compress_metadata, dictionary, indexed_translations))
         else:
-            error(doc, "Translation keys to include were provided, but no translation data in descriptor.")
+            error(None, "Translation keys to include were provided, but no translation data in descriptor.")
     _check_size(max(map(len, metadata_sets)) + len(data), tag_size)
+    return [data] + metadata_sets
+
+def _generate_compiled_metadata(compiled, translations, compress_metadata, dictionary, indexed_translations) -> bytes:
+    # Properties are serialized once per descriptor, only translations differ between metadata sets
+    return generate_metadata(
+        compiled.device_info,
+        compiled.ids,
+        compiled.properties,
+        translations,
+        compress_metadata,
+        dictionary,
+        indexed_translations,
+        compiled.serialized_properties)
+
+def _create_rom_blob(blobs, hash_func) -> bytes:
     output = []
-    output.append(1 + len(metadata_sets))
+    output.append(len(blobs))
     output.append(hash_func.digest_size)
-    start_addr = 2
-    output.extend(_create_blob_descriptor(data, hash_func, start_addr))
-    for meta in metadata_sets:
-        output.extend(_create_blob_descriptor(meta, hash_func, start_addr))
-        start_addr += 8 + hash_func.digest_size
-    output.extend(data)
-    for meta in metadata_sets:
-        output.extend(meta)
-    if not output_path.endswith(sep):
-        output_path = output_path + sep
-    blob_file = output_path + "rom_blob.bin"
-    with open(blob_file, "wb") as file:
-        file.write(bytes(output))
+    # Start addresses are offsets from the beginning of the ROM blob, blobs follow the descriptors
+    start_addr = ROM_BLOB_HEADER_SIZE + len(blobs) * (8 + hash_func.digest_size)
+    stored = {}
+    contents = []
+    for blob in blobs:
+        # Digests may collide for CRC-32, so identical blobs are looked up by content
+        blob = bytes(blob)
+        if blob not in stored:
+            stored[blob] = start_addr
+            contents.append(blob)
+            start_addr += len(blob)
+        output.extend(_create_blob_descriptor(blob, hash_func, stored[blob]))
+    for blob in contents:
+        output.extend(blob)
+    return bytes(output)
 
 def _create_blob_descriptor(data, hash_func, start_addr) -> bytes:
-    hash_func.update(data)
-    digest = hash_func.digest()
+    # HASH_* are shared instances, hash on a copy so digests don't include previously hashed blobs
+    hasher = hash_func.copy()
+    hasher.update(data)
+    digest = hasher.digest()
     arr = []
     arr.extend(digest)
     start = start_addr.to_bytes(length=4, byteorder="big", signed=False)
@@ -141,7 +224,21 @@ def export_all(
         generate_getters=False,
         include_utils=True,
         tag_size=-1,
-        tab_spaces=None) -> None:
+        tab_spaces=None,
+        generate_view=False,
+        generate_batch=False,
+        generate_columns=False,
+        generate_delta=False,
+        generate_layout=False,
+        generate_cpp=False,
+        generate_branchless=False,
+        dictionary=None,
+        indexed_translations=False,
+        array_unroll_threshold=None,
+        generate_snapshot=False,
+        generate_decode_cache=False,
+        generate_fixp_kernels=False,
+        schema_cache=None) -> None:
     """Export all files at once -  Binary data and metadata, C library files, and JSON.
 
     Args:
@@ -154,16 +251,26 @@ def export_all(
         include_utils (bool): include utility code in generated files or use seperate files
         tag_size (int): memory size of used tag
         tab_spaces (int): number of spaces to use for tabs in code
+        generate_view (bool): generate view struct and accessors decoding properties on demand
+        generate_batch (bool): generate function parsing multiple NFC memory dumps at once
+        generate_columns (bool): generate columnar storage struct and decoder for multiple payloads
+        generate_delta (bool): generate dirty flags and function determining changed byte ranges of payload
+        generate_layout (bool): generate C table and C++ header containing offsets, sizes and limits of properties
+        generate_cpp (bool): generate header-only C++17 library in addition to C library
+        generate_branchless (bool): generate safe getters without branches and function clamping all properties at once
+        dictionary (bytes): preset dictionary to compress metadata with, see export_dictionary
+        indexed_translations (bool): serialize translations with offset tables for lookups of single strings
+        array_unroll_threshold (int): maximum number of array entries to unroll parsing and generation code for
+        generate_snapshot (bool): generate struct and functions sharing the configuration between threads with a sequence lock
+        generate_decode_cache (bool): generate LRU cache of decoded payloads and parsing functions using it
+        generate_fixp_kernels (bool): generate fixed point arithmetic specialized to the scales of fixed point properties
+        schema_cache (str): folder to cache compiled descriptors in, see compile_descriptor
     """
 
-    doc = parse(config_file)
-    translations = None
-    if "translation_data" in doc:
-        translations = doc["translation_data"]
-    props = get_properties(doc)
-    ids = get_ids(doc)
-    dev_info = get_device_info(doc)
-    metadata = generate_metadata(dev_info, ids, props, translations, compress_metadata)
+    compiled = compile_descriptor(config_file, schema_cache)
+    props = compiled.properties
+    dev_info = compiled.device_info
+    metadata = _generate_compiled_metadata(compiled, compiled.translations, compress_metadata, dictionary, indexed_translations)
     data = generate_data(props)
     data_len = sum(map(lambda p: p.get_data_size(), props)) + 8
     _check_size(len(metadata) + len(data), tag_size)
@@ -173,17 +280,38 @@ def export_all(
         generate_enums=generate_enums,
         generate_getters=generate_getters,
         include_utils=include_utils,
-        tab_spaces=tab_spaces)
+        tab_spaces=tab_spaces,
+        generate_view=generate_view,
+        generate_batch=generate_batch,
+        generate_columns=generate_columns,
+        generate_delta=generate_delta,
+        generate_layout=generate_layout,
+        generate_branchless=generate_branchless,
+        generate_snapshot=generate_snapshot,
+        generate_decode_cache=generate_decode_cache,
+        generate_fixp_kernels=generate_fixp_kernels)
     lib_c_content = generate_lib_code(
         props,
         lib_name,
         generate_getters=generate_getters,
         include_utils=include_utils,
-        tab_spaces=tab_spaces)
+        tab_spaces=tab_spaces,
+        generate_view=generate_view,
+        generate_batch=generate_batch,
+        generate_columns=generate_columns,
+        generate_delta=generate_delta,
+        generate_layout=generate_layout,
+        generate_branchless=generate_branchless,
+        array_unroll_threshold=array_unroll_threshold,
+        generate_snapshot=generate_snapshot,
+        generate_decode_cache=generate_decode_cache)
     json_content = {
         "metadata": {
             "compressed": compress_metadata,
-            "device_id": encode_base64(generate_device_id(doc)),
+            "dictionary_id": None if dictionary is None or not compress_metadata else f"{get_dictionary_id(dictionary):08x}",
+            "device_id": encode_base64(compiled.device_id),
+            "indexed_translations": indexed_translations,
+            "translations_offset": get_translations_offset(dev_info, props, compiled.serialized_properties),
             "payload": encode_base64(metadata)
         },
         "data": {
@@ -206,6 +334,21 @@ def export_all(
         file.write(lib_h_content)
     with open(c_file, "w") as file:
         file.write(lib_c_content)
+    if generate_layout:
+        hpp_file = output_path + HPP_LAYOUT_FILENAME_TEMPLATE.format(lib_name=lib_name)
+        with open(hpp_file, "w") as file:
+            file.write(generate_layout_header(props, lib_name, tab_spaces=tab_spaces))
+    if generate_cpp:
+        hpp_file = output_path + HPP_FILENAME_TEMPLATE.format(lib_name=lib_name)
+        with open(hpp_file, "w") as file:
+            file.write(generate_lib_cpp_header(
+                props,
+                lib_name,
+                generate_enums=generate_enums,
+                include_utils=include_utils,
+                tab_spaces=tab_spaces))
+        if not include_utils:
+            copy_cpp_utils(output_path)
     with open(json_file, "w") as file:
         json.dump(json_content, file)
     if not include_utils:
@@ -218,7 +361,19 @@ def export_lib(
         generate_enums=False,
         generate_getters=False,
         include_utils=True,
-        tab_spaces=None) -> None:
+        tab_spaces=None,
+        generate_view=False,
+        generate_batch=False,
+        generate_columns=False,
+        generate_delta=False,
+        generate_layout=False,
+        generate_cpp=False,
+        generate_branchless=False,
+        array_unroll_threshold=None,
+        generate_snapshot=False,
+        generate_decode_cache=False,
+        generate_fixp_kernels=False,
+        schema_cache=None) -> None:
     """Export C library files.
 
     Args:
@@ -229,23 +384,52 @@ def export_lib(
         generate_getters (bool): generate safe getter functions for properties
         include_utils (bool): include utility code in generated files or use seperate files
         tab_spaces (int): number of spaces to use for tabs in code
+        generate_view (bool): generate view struct and accessors decoding properties on demand
+        generate_batch (bool): generate function parsing multiple NFC memory dumps at once
+        generate_columns (bool): generate columnar storage struct and decoder for multiple payloads
+        generate_delta (bool): generate dirty flags and function determining changed byte ranges of payload
+        generate_layout (bool): generate C table and C++ header containing offsets, sizes and limits of properties
+        generate_cpp (bool): generate header-only C++17 library in addition to C library
+        generate_branchless (bool): generate safe getters without branches and function clamping all properties at once
+        array_unroll_threshold (int): maximum number of array entries to unroll parsing and generation code for
+        generate_snapshot (bool): generate struct and functions sharing the configuration between threads with a sequence lock
+        generate_decode_cache (bool): generate LRU cache of decoded payloads and parsing functions using it
+        generate_fixp_kernels (bool): generate fixed point arithmetic specialized to the scales of fixed point properties
+        schema_cache (str): folder to cache compiled descriptors in, see compile_descriptor
     """
 
-    doc = parse(config_file)
-    props = get_properties(doc)
+    props = compile_descriptor(config_file, schema_cache).properties
     lib_h_content = generate_lib_header(
         props,
         lib_name,
         generate_enums=generate_enums,
         generate_getters=generate_getters,
         include_utils=include_utils,
-        tab_spaces=tab_spaces)
+        tab_spaces=tab_spaces,
+        generate_view=generate_view,
+        generate_batch=generate_batch,
+        generate_columns=generate_columns,
+        generate_delta=generate_delta,
+        generate_layout=generate_layout,
+        generate_branchless=generate_branchless,
+        generate_snapshot=generate_snapshot,
+        generate_decode_cache=generate_decode_cache,
+        generate_fixp_kernels=generate_fixp_kernels)
     lib_c_content = generate_lib_code(
         props,
         lib_name,
         generate_getters=generate_getters,
         include_utils=include_utils,
-        tab_spaces=tab_spaces)
+        tab_spaces=tab_spaces,
+        generate_view=generate_view,
+        generate_batch=generate_batch,
+        generate_columns=generate_columns,
+        generate_delta=generate_delta,
+        generate_layout=generate_layout,
+        generate_branchless=generate_branchless,
+        array_unroll_threshold=array_unroll_threshold,
+        generate_snapshot=generate_snapshot,
+        generate_decode_cache=generate_decode_cache)
     if not output_path.endswith(sep):
         output_path = output_path + sep
     h_file = output_path + H_FILENAME_TEMPLATE.format(lib_name=lib_name)
@@ -254,5 +438,179 @@ def export_lib(
         file.write(lib_h_content)
     with open(c_file, "w") as file:
         file.write(lib_c_content)
+    if generate_layout:
+        hpp_file = output_path + HPP_LAYOUT_FILENAME_TEMPLATE.format(lib_name=lib_name)
+        with open(hpp_file, "w") as file:
+            file.write(generate_layout_header(props, lib_name, tab_spaces=tab_spaces))
+    if generate_cpp:
+        hpp_file = output_path + HPP_FILENAME_TEMPLATE.format(lib_name=lib_name)
+        with open(hpp_file, "w") as file:
+            file.write(generate_lib_cpp_header(
+                props,
+                lib_name,
+                generate_enums=generate_enums,
+                include_utils=include_utils,
+                tab_spaces=tab_spaces))
+        if not include_utils:
+            copy_cpp_utils(output_path)
     if not include_utils:
         copy_utils(output_path)
+
+DICTIONARY_FILENAME = "metadata_dictionary.bin"
+DICTIONARY_H_FILENAME = "metadata_dictionary.h"
+
+DICTIONARY_H_TEMPLATE = """#ifndef METADATA_DICTIONARY_H
+#define METADATA_DICTIONARY_H
+
+#include <stdint.h>
+
+// Preset dictionary for inflating metadata, e.g. with inflateSetDictionary
+// Compare get_zlib_dictionary_id of compressed metadata with METADATA_DICTIONARY_ID before use
+#define METADATA_DICTIONARY_ID 0x{dictionary_id:08X}u
+#define METADATA_DICTIONARY_SIZE {dictionary_size}
+
+static const uint8_t metadata_dictionary[METADATA_DICTIONARY_SIZE] = {{
+{dictionary_bytes}
+}};
+
+#endif // METADATA_DICTIONARY_H
+"""
+
+def export_dictionary(config_files, output_path, size=DICTIONARY_SIZE, schema_cache=None) -> int:
+    """Train a preset dictionary for metadata compression on many descriptors and export it as binary and C header.
+    Metadata of descriptors resembling the training set compresses better with the dictionary,
+    but the dictionary must be available to everyone decompressing the metadata.
+
+    Args:
+        config_files (list): the files to read the YAML configuration definitions from
+        output_path (str): path to output files to
+        size (int): maximum size of the dictionary in bytes
+        schema_cache (str): folder to cache compiled descriptors in, see compile_descriptor
+
+    Returns:
+        int: the dictionary ID, stored in the header of metadata compressed with the dictionary
+    """
+
+    samples = []
+    for config_file in config_files:
+        compiled = compile_descriptor(config_file, schema_cache)
+        samples.append(serialize_metadata(
+            compiled.device_info,
+            compiled.ids,
+            compiled.properties,
+            compiled.translations,
+            serialized_properties=compiled.serialized_properties))
+    dictionary = train_dictionary(samples, size)
+    if len(dictionary) == 0:
+        error(None, "Descriptors have no metadata in common, can't train dictionary")
+    dictionary_id = get_dictionary_id(dictionary)
+    lines = []
+    for offset in range(0, len(dictionary), 16):
+        lines.append("    " + " ".join(f"0x{byte:02X}," for byte in dictionary[offset:offset + 16]))
+    h_content = DICTIONARY_H_TEMPLATE.format(
+        dictionary_id=dictionary_id,
+        dictionary_size=len(dictionary),
+        dictionary_bytes="\n".join(lines))
+    if not output_path.endswith(sep):
+        output_path = output_path + sep
+    with open(output_path + DICTIONARY_FILENAME, "wb") as file:
+        file.write(dictionary)
+    with open(output_path + DICTIONARY_H_FILENAME, "w") as file:
+        file.write(h_content)
+    return dictionary_id
+
+CACHE_DIRNAME = ".eputgen_cache"
+CACHE_KEY_FILENAME = ".eputgen_cache_key"
+
+def _cache_key(descriptor, fingerprint, lib_name, compress_metadata, options) -> str:
+    key = {
+        "descriptor": descriptor,
+        "generator": fingerprint,
+        "lib_name": lib_name,
+        "compress_metadata": compress_metadata,
+        "options": options
+    }
+    # Options may contain bytes, e.g. the metadata dictionary
+    return hashlib.sha256(json.dumps(key, sort_keys=True, default=bytes.hex).encode("utf-8")).hexdigest()
+
+def _read_cache_key(lib_output) -> str:
+    try:
+        with open(os.path.join(lib_output, CACHE_KEY_FILENAME), "r") as file:
+            return file.read()
+    except OSError:
+        return None
+
+def _export_cached(config_file, lib_output, cache_entry, key, lib_name, compress_metadata, schema_cache, options) -> bool:
+    generated = False
+    if not os.path.isdir(cache_entry):
+        temp_entry = f"{cache_entry}.{os.getpid()}.tmp"
+        os.makedirs(temp_entry, exist_ok=True)
+        export_all(config_file, temp_entry, lib_name, compress_metadata, schema_cache=schema_cache, **options)
+        try:
+            os.rename(temp_entry, cache_entry)
+        except OSError:
+            # Another process created the same entry in the meantime
+            shutil.rmtree(temp_entry)
+        generated = True
+    os.makedirs(lib_output, exist_ok=True)
+    for filename in os.listdir(cache_entry):
+        shutil.copy2(os.path.join(cache_entry, filename), os.path.join(lib_output, filename))
+    with open(os.path.join(lib_output, CACHE_KEY_FILENAME), "w") as file:
+        file.write(key)
+    return generated
+
+def export_batch(
+        config_files,
+        output_path,
+        compress_metadata,
+        cache_path=None,
+        jobs=None,
+        schema_cache=None,
+        **options) -> dict:
+    """Export all files for many descriptors at once using a process pool and a content-addressed cache.
+    Files of each descriptor are written to a folder named after the descriptor file, which is also used as library name.
+    Descriptors are only exported again if the descriptor including included files, generator or options changed.
+
+    Args:
+        config_files (list): the files to read the YAML configuration definitions from
+        output_path (str): path to create the output folders in
+        compress_metadata (bool): compress metadata with deflate
+        cache_path (str): folder to store cache entries in, defaults to a folder in output_path
+        jobs (int): number of processes to use, defaults to the number of processors
+        schema_cache (str): folder to cache compiled descriptors in, see compile_descriptor
+        options: additional arguments to export_all, e.g. generate_enums
+
+    Returns:
+        dict: library names mapped to "unchanged", "cached" or "generated"
+    """
+
+    if cache_path is None:
+        cache_path = os.path.join(output_path, CACHE_DIRNAME)
+    os.makedirs(cache_path, exist_ok=True)
+    # Changes to the generator or the utility code invalidate all cache entries
+    fingerprint = generator_fingerprint()
+    results = {}
+    pending = {}
+    with ProcessPoolExecutor(max_workers=jobs) as executor:
+        for config_file in config_files:
+            lib_name = Path(config_file).stem
+            if lib_name in results or lib_name in pending:
+                error(None, f"Multiple descriptors named {lib_name}")
+            lib_output = os.path.join(output_path, lib_name)
+            key = _cache_key(read_descriptor(config_file), fingerprint, lib_name, compress_metadata, options)
+            if _read_cache_key(lib_output) == key:
+                results[lib_name] = "unchanged"
+                continue
+            pending[lib_name] = executor.submit(
+                _export_cached,
+                config_file,
+                lib_output,
+                os.path.join(cache_path, key),
+                key,
+                lib_name,
+                compress_metadata,
+                schema_cache,
+                options)
+        for lib_name, future in pending.items():
+            results[lib_name] = "generated" if future.result() else "cached"
+    return results
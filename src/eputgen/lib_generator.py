@@ -14,7 +14,7 @@ LIB_H_TEMPLATE = """#ifndef {namespace}
 #include <stddef.h>{utils_include}
 typedef struct {{
 {data_struct_content}{tab}time_point data_last_written_timestamp;
-}} {data_struct_name};
+{dirty_member}}} {data_struct_name};
 
 {enums}
 #define DATA_PAYLOAD_LENGTH {data_len}
@@ -45,6 +45,8 @@ int parse_payload(uint8_t *buf, size_t buf_len, {data_struct_name} *config);
 /**
  * @brief Parse the contents of NFC memory into a struct according to the configuration definition.
  * 
+ * Only the data record is read and validated, the meta data record is skipped.
+ * 
  * @param buf Buffer containing the data from NFC memory
  * @param buf_len Size of `buf`
  * @param config pointer to an instance of the configuration struct
@@ -56,6 +58,8 @@ int parse_nfc(uint8_t *buf, size_t buf_len, {data_struct_name} *config);
 /**
  * @brief Parse an NDEF message into a struct according to the configuration definition.
  * 
+ * Only the data record is read and validated, the meta data record is skipped.
+ * 
  * @param buf Buffer containing the NDEF message
  * @param buf_len Size of buffer
  * @param config pointer to an instance of the configuration struct
@@ -65,23 +69,67 @@ int parse_nfc(uint8_t *buf, size_t buf_len, {data_struct_name} *config);
 int parse_ndef(uint8_t *buf, size_t buf_len, {data_struct_name} *config);
 
 {getters}
-
+{view}{batch}{columns}{delta}{layout}{snapshot}{decode_cache}{fixp_kernels}
 #endif
 
 """
 
+LIB_H_VIEW_TEMPLATE = """
+/**
+ * @brief View on the payload of a data record.
+ *
+ * Properties are decoded on access directly from `buf`, the buffer has to stay valid while the view is used.
+ * String and selection bitmap accessors return pointers into `buf`, strings are not guaranteed to be terminated.
+ */
+typedef struct {{
+{tab}uint8_t *buf;
+}} {view_struct_name};
+
+/**
+ * @brief Create a view on the payload of a data record without decoding it.
+ * 
+ * @param buf Buffer containing the payload from NDEF record
+ * @param buf_len Size of payload
+ * @param view pointer to an instance of the view struct
+ *
+ * @return status code
+ */
+int parse_payload_view(uint8_t *buf, size_t buf_len, {view_struct_name} *view);
+
+/**
+ * @brief Create a view on the data record payload contained in NFC memory without decoding it.
+ * 
+ * @param buf Buffer containing the data from NFC memory
+ * @param buf_len Size of `buf`
+ * @param view pointer to an instance of the view struct
+ *
+ * @return status code
+ */
+int parse_nfc_view(uint8_t *buf, size_t buf_len, {view_struct_name} *view);
+
+{view_getters}
+static inline time_point view_get_data_last_written_timestamp({view_struct_name} *view) {{
+{tab}return bytes_to_time_point(view->buf + {timestamp_index});
+}}
+"""
+
 LIB_C_TEMPLATE = """#include <stdint.h>
+#include <string.h>
 #include "{h_filename}"
 {utils_include}
 int generate_payload(uint8_t *buf, {data_struct_name} *config) {{
-{data_generation_snippet}{tab}return SUCCESS;
+{tab}EPUT_TRACE_BEGIN(EPUT_TRACE_GENERATE_PAYLOAD);
+{data_generation_snippet}{tab}EPUT_TRACE_END(EPUT_TRACE_GENERATE_PAYLOAD, {data_length});
+{tab}return SUCCESS;
 }}
 
 int parse_payload(uint8_t *buf, size_t buf_len, {data_struct_name} *config) {{
 {tab}if (buf_len != {data_length}) {{
 {tab}{tab}return ERR_DATA_BUF_WRONG_LENGTH;
 {tab}}}
-{data_parsing_snippet}{tab}return SUCCESS;
+{tab}EPUT_TRACE_BEGIN(EPUT_TRACE_PARSE_PAYLOAD);
+{data_parsing_snippet}{tab}EPUT_TRACE_END(EPUT_TRACE_PARSE_PAYLOAD, {data_length});
+{tab}return SUCCESS;
 }}
 
 int parse_nfc(uint8_t *buf, size_t buf_len, {data_struct_name} *config) {{
@@ -90,14 +138,12 @@ int parse_nfc(uint8_t *buf, size_t buf_len, {data_struct_name} *config) {{
 {tab}if (ndef_length == 0 || (ndef_offset + ndef_length) > buf_len) {{
 {tab}{tab}return ERR_NO_NDEF_TLV;
 {tab}}} else {{
-{tab}{tab}ndef_record meta = {{0}};
 {tab}{tab}ndef_record data = {{0}};
-{tab}{tab}int parse_ret = get_records(
+{tab}{tab}int parse_ret = get_data_record(
 {tab}{tab}{tab}buf + ndef_offset,
 {tab}{tab}{tab}ndef_length,
-{tab}{tab}{tab}&meta,
 {tab}{tab}{tab}&data);
-{tab}{tab}if (parse_ret == SUCCESS) {{
+{tab}{tab}if (parse_ret > 0) {{
 {tab}{tab}{tab}return parse_payload(
 {tab}{tab}{tab}{tab}data.payload,
 {tab}{tab}{tab}{tab}data.payload_length,
@@ -109,10 +155,9 @@ int parse_nfc(uint8_t *buf, size_t buf_len, {data_struct_name} *config) {{
 }}
 
 int parse_ndef(uint8_t *buf, size_t buf_len, {data_struct_name} *config) {{
-{tab}ndef_record meta = {{0}};
 {tab}ndef_record data = {{0}};
-{tab}int record_result = get_records(buf, buf_len, &meta, &data);
-{tab}if (record_result == SUCCESS) {{
+{tab}int record_result = get_data_record(buf, buf_len, &data);
+{tab}if (record_result > 0) {{
 {tab}{tab}return parse_payload(
 {tab}{tab}{tab}data.payload,
 {tab}{tab}{tab}data.payload_length,
@@ -123,13 +168,573 @@ int parse_ndef(uint8_t *buf, size_t buf_len, {data_struct_name} *config) {{
 }}
 
 {getters}
+{view}{batch}{columns}{delta}{layout}{snapshot}{decode_cache}"""
+
+LIB_H_CLAMP_TEMPLATE = """
+/**
+ * @brief Replace every value of the configuration by the result of its safe getter.
+ * 
+ * Call after `parse_payload` to sanitize all properties at once instead of on each access.
+ * 
+ * @param config pointer to an instance of the configuration struct
+ */
+void clamp_all({data_struct_name} *config);
+"""
+
+LIB_C_CLAMP_TEMPLATE = """
+void clamp_all({data_struct_name} *config) {{
+{clamp_snippet}}}
+"""
+
+LIB_H_BATCH_TEMPLATE = """
+/**
+ * @brief Parse the contents of multiple NFC memory dumps into structs.
+ *
+ * Does not use any shared state, disjoint ranges of the arrays can be parsed by different threads.
+ * Dumps of tags with the same layout share all bytes in front of the payload. After one dump was validated,
+ * following dumps starting with the same bytes skip the TLV and record header checks and only parse the payload.
+ * 
+ * @param bufs Buffers containing the data from NFC memory
+ * @param lens Sizes of the buffers in `bufs`
+ * @param n Number of buffers
+ * @param out Array of at least `n` configuration structs to parse into
+ * @param status Array of at least `n` status codes, one per buffer
+ *
+ * @return number of successfully parsed buffers
+ */
+size_t parse_nfc_batch(
+{tab}uint8_t **bufs,
+{tab}const size_t *lens,
+{tab}size_t n,
+{tab}{data_struct_name} *out,
+{tab}int *status);
+"""
+
+LIB_H_COLUMNS_TEMPLATE = """
+/**
+ * @brief Column-wise storage of multiple decoded configurations.
+ *
+ * Every member points to a caller provided array with one element per payload.
+ * Members set to `NULL` are skipped during decoding.
+ */
+typedef struct {{
+{column_members}{tab}time_point *data_last_written_timestamp;
+}} {columns_struct_name};
+
+/**
+ * @brief Decode multiple payloads of data records into columns.
+ *
+ * Assumes `payloads` contains `n` payloads of `DATA_PAYLOAD_LENGTH` bytes each, stored back to back.
+ * 
+ * @param payloads Buffer containing the payloads
+ * @param n Number of payloads
+ * @param columns pointer to an instance of the columns struct
+ *
+ * @return status code
+ */
+int parse_payload_columns(uint8_t *payloads, size_t n, {columns_struct_name} *columns);
+"""
+
+LIB_C_COLUMNS_TEMPLATE = """
+int parse_payload_columns(uint8_t *payloads, size_t n, {columns_struct_name} *columns) {{
+{column_parsing_snippet}{tab}return SUCCESS;
+}}
+"""
+
+LIB_H_DELTA_TEMPLATE = """
+#define DIRTY_FLAGS_COUNT {dirty_count}
+
+{dirty_indices}
+/**
+ * @brief Mark a property as changed, so it is included in the next delta.
+ *
+ * @param config pointer to an instance of the configuration struct
+ * @param property `DIRTY_` index of the property
+ */
+static inline void mark_dirty({data_struct_name} *config, size_t property) {{
+{tab}config->dirty[property / 8] |= (uint8_t) (1u << (property % 8));
+}}
+
+/**
+ * @brief Create the payload of a data record and determine the byte ranges of changed properties.
+ *
+ * Writes the whole payload to `buf` like `generate_payload`, but only the returned ranges differ from the
+ * previous payload and have to be written to the tag. Ranges are aligned to pages of `page_size` bytes
+ * and clipped to the payload, so the first and last page of the payload may be covered partially.
+ * Clears the dirty flags of `config`, which have to be zero-initialized before the first use.
+ * 
+ * @param buf Buffer to write data to, at least `DATA_PAYLOAD_LENGTH` long
+ * @param config Pointer to the configuration struct
+ * @param ranges Buffer to store ranges in payload to
+ * @param max_ranges Capacity of `ranges`, ranges are merged if it is exceeded
+ * @param range_count Pointer to store number of ranges to
+ * @param page_size Size of tag memory pages
+ * @param base_offset Offset of the payload in tag memory
+ *
+ * @return status code
+ */
+int generate_payload_delta(
+{tab}uint8_t *buf,
+{tab}{data_struct_name} *config,
+{tab}byte_range *ranges,
+{tab}size_t max_ranges,
+{tab}size_t *range_count,
+{tab}size_t page_size,
+{tab}size_t base_offset);
+"""
+
+LIB_C_DELTA_TEMPLATE = """
+static const byte_range property_ranges[DIRTY_FLAGS_COUNT] = {{
+{property_ranges}}};
+
+int generate_payload_delta(
+{tab}uint8_t *buf,
+{tab}{data_struct_name} *config,
+{tab}byte_range *ranges,
+{tab}size_t max_ranges,
+{tab}size_t *range_count,
+{tab}size_t page_size,
+{tab}size_t base_offset) {{
+{tab}int ret = generate_payload(buf, config);
+{tab}if (ret != SUCCESS) {{
+{tab}{tab}return ret;
+{tab}}}
+{tab}size_t count = 0;
+{tab}for (size_t i = 0; i < DIRTY_FLAGS_COUNT; i++) {{
+{tab}{tab}if ((config->dirty[i / 8] & (1u << (i % 8))) != 0) {{
+{tab}{tab}{tab}count = add_byte_range(
+{tab}{tab}{tab}{tab}ranges,
+{tab}{tab}{tab}{tab}count,
+{tab}{tab}{tab}{tab}max_ranges,
+{tab}{tab}{tab}{tab}property_ranges[i],
+{tab}{tab}{tab}{tab}DATA_PAYLOAD_LENGTH,
+{tab}{tab}{tab}{tab}page_size,
+{tab}{tab}{tab}{tab}base_offset);
+{tab}{tab}}}
+{tab}}}
+{tab}for (size_t i = 0; i < sizeof(config->dirty); i++) {{
+{tab}{tab}config->dirty[i] = 0;
+{tab}}}
+{tab}*range_count = count;
+{tab}return SUCCESS;
+}}
+"""
+
+LIB_H_SNAPSHOT_TEMPLATE = """
+// Configuration published by a single writer, e.g. the NFC interrupt, to any number of reader threads.
+// Zero-initialize before use. The parsing functions use no shared state and can run concurrently on distinct buffers.
+typedef struct {{
+{tab}uint32_t sequence;
+{tab}{data_struct_name} config;
+}} {snapshot_struct_name};
+
+/**
+ * @brief Publish a configuration to readers of the snapshot without waiting for them.
+ *
+ * Must not be called concurrently, e.g. only from the NFC interrupt after `parse_nfc` succeeded.
+ * 
+ * @param snapshot pointer to the shared snapshot
+ * @param config pointer to the configuration to publish
+ */
+void publish_config({snapshot_struct_name} *snapshot, const {data_struct_name} *config);
+
+/**
+ * @brief Copy the latest configuration published to the snapshot.
+ *
+ * Never blocks the writer, the copy is retried if a configuration was published meanwhile.
+ * 
+ * @param snapshot pointer to the shared snapshot
+ * @param config pointer to store a consistent copy of the configuration to
+ */
+void read_config({snapshot_struct_name} *snapshot, {data_struct_name} *config);
+"""
+
+LIB_C_SNAPSHOT_TEMPLATE = """
+// Sequence lock: the sequence is odd while the writer copies, readers retry until it is even and unchanged
+
+void publish_config({snapshot_struct_name} *snapshot, const {data_struct_name} *config) {{
+{tab}uint32_t sequence = __atomic_load_n(&snapshot->sequence, __ATOMIC_RELAXED);
+{tab}__atomic_store_n(&snapshot->sequence, sequence + 1, __ATOMIC_RELAXED);
+{tab}__atomic_thread_fence(__ATOMIC_RELEASE);
+{tab}memcpy(&snapshot->config, config, sizeof(*config));
+{tab}__atomic_store_n(&snapshot->sequence, sequence + 2, __ATOMIC_RELEASE);
+}}
+
+void read_config({snapshot_struct_name} *snapshot, {data_struct_name} *config) {{
+{tab}uint32_t before;
+{tab}uint32_t after;
+{tab}do {{
+{tab}{tab}before = __atomic_load_n(&snapshot->sequence, __ATOMIC_ACQUIRE);
+{tab}{tab}memcpy(config, &snapshot->config, sizeof(*config));
+{tab}{tab}__atomic_thread_fence(__ATOMIC_ACQUIRE);
+{tab}{tab}after = __atomic_load_n(&snapshot->sequence, __ATOMIC_RELAXED);
+{tab}}} while ((before & 1) != 0 || before != after);
+}}
+"""
+
+LIB_H_DECODE_CACHE_TEMPLATE = """
+// Decoded payload, unused if `last_used` is 0
+typedef struct {{
+{tab}uint64_t hash;
+{tab}uint64_t last_used;
+{tab}uint8_t payload[DATA_PAYLOAD_LENGTH];
+{tab}{data_struct_name} config;
+}} {cache_entry_name};
+
+// Least recently used payloads and their decoded configurations, initialize with `decode_cache_init`
+typedef struct {{
+{tab}{cache_entry_name} *entries;
+{tab}size_t capacity;
+{tab}uint64_t clock;
+{tab}uint32_t hits;
+{tab}uint32_t misses;
+}} {cache_name};
+
+/**
+ * @brief Prepare a decode cache using caller-supplied entries, no memory is allocated.
+ *
+ * Entries are searched linearly, so a few dozen entries are usually best.
+ * 
+ * @param cache pointer to cache to initialize
+ * @param entries array of entries to store decoded payloads in
+ * @param capacity number of entries in `entries`
+ */
+void decode_cache_init({cache_name} *cache, {cache_entry_name} *entries, size_t capacity);
+
+/**
+ * @brief Parse the payload of a data record like `parse_payload`, reusing the result for known payloads.
+ *
+ * Payloads are looked up by hash and compared in full, the least recently used entry is replaced on a miss.
+ * Counts hits and misses in `cache`.
+ * 
+ * @param buf Buffer containing the payload from NDEF record
+ * @param buf_len Size of payload
+ * @param cache pointer to decode cache, must not be used by other threads concurrently
+ * @param config pointer to an instance of the configuration struct
+ *
+ * @return status code
+ */
+int parse_payload_cached(uint8_t *buf, size_t buf_len, {cache_name} *cache, {data_struct_name} *config);
+
+/**
+ * @brief Parse the contents of NFC memory like `parse_nfc`, reusing the result for known payloads.
+ * 
+ * @param buf Buffer containing the data from NFC memory
+ * @param buf_len Size of `buf`
+ * @param cache pointer to decode cache, must not be used by other threads concurrently
+ * @param config pointer to an instance of the configuration struct
+ *
+ * @return status code
+ */
+int parse_nfc_cached(uint8_t *buf, size_t buf_len, {cache_name} *cache, {data_struct_name} *config);
+"""
+
+LIB_C_DECODE_CACHE_TEMPLATE = """
+void decode_cache_init({cache_name} *cache, {cache_entry_name} *entries, size_t capacity) {{
+{tab}cache->entries = entries;
+{tab}cache->capacity = capacity;
+{tab}cache->clock = 0;
+{tab}cache->hits = 0;
+{tab}cache->misses = 0;
+{tab}for (size_t i = 0; i < capacity; i++) {{
+{tab}{tab}entries[i].last_used = 0;
+{tab}}}
+}}
+
+int parse_payload_cached(uint8_t *buf, size_t buf_len, {cache_name} *cache, {data_struct_name} *config) {{
+{tab}if (buf_len != DATA_PAYLOAD_LENGTH) {{
+{tab}{tab}return ERR_DATA_BUF_WRONG_LENGTH;
+{tab}}}
+{tab}uint64_t hash = hash_bytes(buf, buf_len);
+{tab}{cache_entry_name} *victim = NULL;
+{tab}cache->clock++;
+{tab}for (size_t i = 0; i < cache->capacity; i++) {{
+{tab}{tab}{cache_entry_name} *entry = cache->entries + i;
+{tab}{tab}if (entry->last_used != 0 && entry->hash == hash && memcmp(entry->payload, buf, DATA_PAYLOAD_LENGTH) == 0) {{
+{tab}{tab}{tab}entry->last_used = cache->clock;
+{tab}{tab}{tab}cache->hits++;
+{tab}{tab}{tab}*config = entry->config;
+{tab}{tab}{tab}return SUCCESS;
+{tab}{tab}}}
+{tab}{tab}if (victim == NULL || entry->last_used < victim->last_used) {{
+{tab}{tab}{tab}victim = entry;
+{tab}{tab}}}
+{tab}}}
+{tab}cache->misses++;
+{tab}int ret = parse_payload(buf, buf_len, config);
+{tab}if (ret == SUCCESS && victim != NULL) {{
+{tab}{tab}victim->hash = hash;
+{tab}{tab}victim->last_used = cache->clock;
+{tab}{tab}memcpy(victim->payload, buf, DATA_PAYLOAD_LENGTH);
+{tab}{tab}victim->config = *config;
+{tab}}}
+{tab}return ret;
+}}
+
+int parse_nfc_cached(uint8_t *buf, size_t buf_len, {cache_name} *cache, {data_struct_name} *config) {{
+{tab}size_t ndef_offset = 0;
+{tab}uint16_t ndef_length = get_ndef_tlv_offset(buf, buf_len, &ndef_offset);
+{tab}if (ndef_length == 0 || (ndef_offset + ndef_length) > buf_len) {{
+{tab}{tab}return ERR_NO_NDEF_TLV;
+{tab}}}
+{tab}ndef_record data = {{0}};
+{tab}int parse_ret = get_data_record(buf + ndef_offset, ndef_length, &data);
+{tab}if (parse_ret <= 0) {{
+{tab}{tab}return parse_ret;
+{tab}}}
+{tab}return parse_payload_cached(data.payload, data.payload_length, cache, config);
+}}
+"""
+
+LIB_C_BATCH_TEMPLATE = """
+size_t parse_nfc_batch(
+{tab}{tab}uint8_t **bufs,
+{tab}{tab}const size_t *lens,
+{tab}{tab}size_t n,
+{tab}{tab}{data_struct_name} *out,
+{tab}{tab}int *status) {{
+{tab}size_t parsed = 0;
+{tab}// Last validated dump, TLVs and record header are the first `known_header` bytes, the NDEF message ends at `known_end`
+{tab}uint8_t *known = NULL;
+{tab}size_t known_header = 0;
+{tab}size_t known_payload = 0;
+{tab}size_t known_end = 0;
+{tab}for (size_t i = 0; i < n; i++) {{
+{tab}{tab}uint8_t *buf = bufs[i];
+{tab}{tab}size_t buf_len = lens[i];
+{tab}{tab}if (known != NULL && buf_len >= known_end && memcmp(buf, known, known_header) == 0) {{
+{tab}{tab}{tab}status[i] = parse_payload(buf + known_header, known_payload, out + i);
+{tab}{tab}}} else {{
+{tab}{tab}{tab}size_t ndef_offset = 0;
+{tab}{tab}{tab}uint16_t ndef_length = get_ndef_tlv_offset(buf, buf_len, &ndef_offset);
+{tab}{tab}{tab}ndef_record data = {{0}};
+{tab}{tab}{tab}if (ndef_length == 0 || (ndef_offset + ndef_length) > buf_len) {{
+{tab}{tab}{tab}{tab}status[i] = ERR_NO_NDEF_TLV;
+{tab}{tab}{tab}}} else if ((status[i] = get_data_record(buf + ndef_offset, ndef_length, &data)) > 0) {{
+{tab}{tab}{tab}{tab}known = buf;
+{tab}{tab}{tab}{tab}known_header = (size_t) (data.payload - buf);
+{tab}{tab}{tab}{tab}known_payload = data.payload_length;
+{tab}{tab}{tab}{tab}known_end = ndef_offset + ndef_length;
+{tab}{tab}{tab}{tab}status[i] = parse_payload(data.payload, data.payload_length, out + i);
+{tab}{tab}{tab}}}
+{tab}{tab}}}
+{tab}{tab}if (status[i] == SUCCESS) {{
+{tab}{tab}{tab}parsed++;
+{tab}{tab}}}
+{tab}}}
+{tab}return parsed;
+}}
+"""
+
+LIB_C_VIEW_TEMPLATE = """
+int parse_payload_view(uint8_t *buf, size_t buf_len, {view_struct_name} *view) {{
+{tab}if (buf_len != {data_length}) {{
+{tab}{tab}return ERR_DATA_BUF_WRONG_LENGTH;
+{tab}}}
+{tab}view->buf = buf;
+{tab}return SUCCESS;
+}}
+
+int parse_nfc_view(uint8_t *buf, size_t buf_len, {view_struct_name} *view) {{
+{tab}size_t ndef_offset = 0;
+{tab}uint16_t ndef_length = get_ndef_tlv_offset(buf, buf_len, &ndef_offset);
+{tab}if (ndef_length == 0 || (ndef_offset + ndef_length) > buf_len) {{
+{tab}{tab}return ERR_NO_NDEF_TLV;
+{tab}}}
+{tab}ndef_record data = {{0}};
+{tab}int parse_ret = get_data_record(buf + ndef_offset, ndef_length, &data);
+{tab}if (parse_ret < 0) {{
+{tab}{tab}return parse_ret;
+{tab}}}
+{tab}return parse_payload_view(data.payload, data.payload_length, view);
+}}
+"""
+
+LIB_H_LAYOUT_TEMPLATE = """
+#define PROPERTY_LAYOUT_COUNT {layout_count}
+
+{layout_indices}
+/**
+ * @brief Layout of all properties holding data, ordered by offset.
+ *
+ * Properties in an array follow the entry of the array, which has the size of one array element.
+ * Their offsets are relative to the start of an array element.
+ * Properties in a bit field follow the entry of the bit field with offsets and sizes in bits, see `LAYOUT_FLAG_BITS`.
+ */
+extern const property_layout property_layout_table[PROPERTY_LAYOUT_COUNT];
+"""
+
+LIB_C_LAYOUT_TEMPLATE = """
+const property_layout property_layout_table[PROPERTY_LAYOUT_COUNT] = {{
+{layout_entries}}};
+"""
+
+LIB_HPP_LAYOUT_TEMPLATE = """#ifndef {namespace}_layout
+#define {namespace}_layout
+
+#include <cstddef>
+#include <cstdint>
+
+namespace eput_{namespace} {{
+namespace layout {{
+
+/**
+ * @brief Position and limits of a property in the payload.
+ *
+ * Limits are stored in the `_float` members if `FLAG_FLOAT` is set.
+ */
+struct property {{
+{tab}const char *id;
+{tab}std::int32_t parent;
+{tab}std::uint8_t type_code;
+{tab}std::uint8_t flags;
+{tab}std::size_t offset;
+{tab}std::size_t size;
+{tab}std::size_t count;
+{tab}std::int64_t min_value;
+{tab}std::int64_t max_value;
+{tab}std::int64_t step_size;
+{tab}double min_value_float;
+{tab}double max_value_float;
+{tab}double step_size_float;
+{tab}std::int32_t scale;
+}};
+
+{layout_flags}
+constexpr std::size_t DATA_PAYLOAD_LENGTH = {data_len};
+constexpr std::size_t PROPERTY_LAYOUT_COUNT = {layout_count};
+
+{layout_indices}
+/**
+ * @brief Layout of all properties holding data, ordered by offset.
+ *
+ * Properties in an array follow the entry of the array, which has the size of one array element.
+ * Their offsets are relative to the start of an array element.
+ * Properties in a bit field follow the entry of the bit field with offsets and sizes in bits, see `FLAG_BITS`.
+ */
+constexpr property properties[PROPERTY_LAYOUT_COUNT] = {{
+{layout_entries}}};
+
+}}
+}}
+
+#endif
+"""
+
+LIB_HPP_TEMPLATE = """#ifndef {namespace}_hpp
+#define {namespace}_hpp
+{utils_include}
+namespace eput_{namespace} {{
+
+struct config {{
+{data_struct_content}{tab}eput::time_point data_last_written_timestamp;
+}};
+
+{enums}
+constexpr std::size_t DATA_PAYLOAD_LENGTH = {data_len};
+
+namespace fields {{
+{fields}{tab}using data_last_written_timestamp = eput::field<{timestamp_index}, eput::time_point>;
+}}
+
+/**
+ * @brief Decode the payload of a data record into a struct.
+ *
+ * Assumes `payload` is at least `DATA_PAYLOAD_LENGTH` long.
+ * 
+ * @param payload Payload of data record
+ * @param cfg Configuration struct to decode to
+ */
+inline void decode(eput::span<const std::uint8_t> payload, config &cfg) noexcept {{
+{decode_snippet}}}
+
+/**
+ * @brief Encode a struct into the payload of a data record.
+ *
+ * Assumes `payload` is at least `DATA_PAYLOAD_LENGTH` long.
+ * 
+ * @param cfg Configuration struct to encode
+ * @param payload Buffer to write payload to
+ */
+inline void encode(const config &cfg, eput::span<std::uint8_t> payload) noexcept {{
+{encode_snippet}}}
+
+/**
+ * @brief Parse the payload of a data record into a struct.
+ *
+ * @return status code
+ */
+inline int parse_payload(eput::span<const std::uint8_t> payload, config &cfg) noexcept {{
+{tab}if (payload.size() != DATA_PAYLOAD_LENGTH) {{
+{tab}{tab}return eput::ERR_DATA_BUF_WRONG_LENGTH;
+{tab}}}
+{tab}decode(payload, cfg);
+{tab}return eput::SUCCESS;
+}}
+
+/**
+ * @brief Create the payload of a data record from a struct.
+ *
+ * @return status code
+ */
+inline int generate_payload(const config &cfg, eput::span<std::uint8_t> payload) noexcept {{
+{tab}if (payload.size() < DATA_PAYLOAD_LENGTH) {{
+{tab}{tab}return eput::ERR_DATA_BUF_WRONG_LENGTH;
+{tab}}}
+{tab}encode(cfg, payload);
+{tab}return eput::SUCCESS;
+}}
+
+/**
+ * @brief Parse an NDEF message into a struct, only the data record is read.
+ *
+ * @return status code
+ */
+inline int parse_ndef(eput::span<const std::uint8_t> message, config &cfg) noexcept {{
+{tab}eput::ndef_record data{{}};
+{tab}int ret = eput::get_data_record(message, data);
+{tab}if (ret < 0) {{
+{tab}{tab}return ret;
+{tab}}}
+{tab}return parse_payload(data.payload, cfg);
+}}
+
+/**
+ * @brief Parse the contents of NFC memory into a struct.
+ *
+ * @return status code
+ */
+inline int parse_nfc(eput::span<const std::uint8_t> memory, config &cfg) noexcept {{
+{tab}eput::span<const std::uint8_t> message;
+{tab}int ret = eput::find_ndef_message(memory, message);
+{tab}if (ret != eput::SUCCESS) {{
+{tab}{tab}return ret;
+{tab}}}
+{tab}return parse_ndef(message, cfg);
+}}
+
+}}
+
+#endif
 """
 
 UTILS_H_FILENAME = "eput_utils.h"
 UTILS_C_FILENAME = "eput_utils.c"
+UTILS_HPP_FILENAME = "eput_utils.hpp"
 H_FILENAME_TEMPLATE = "eput_{lib_name}.h"
 C_FILENAME_TEMPLATE = "eput_{lib_name}.c"
+HPP_LAYOUT_FILENAME_TEMPLATE = "eput_{lib_name}_layout.hpp"
+HPP_FILENAME_TEMPLATE = "eput_{lib_name}.hpp"
 NONE_FILTER = lambda lis: filter(lambda x: x is not None, lis)
+# Flags of layout entries as name, value and key of the layout entry setting the flag
+# Must match the LAYOUT_FLAG_* defines in eput_utils.h, the C++ layout header defines them as FLAG_*
+LAYOUT_FLAGS = [
+    ("MIN_VALUE", 0x01, "min"),
+    ("MAX_VALUE", 0x02, "max"),
+    ("STEP_SIZE", 0x04, "step"),
+    ("FLOAT", 0x08, "float"),
+    ("BITS", 0x10, "bits")
+]
 
 def generate_lib_header(
         props,
@@ -137,7 +742,16 @@ def generate_lib_header(
         generate_enums=False,
         generate_getters=False,
         include_utils=True,
-        tab_spaces=None) -> str:
+        tab_spaces=None,
+        generate_view=False,
+        generate_batch=False,
+        generate_columns=False,
+        generate_delta=False,
+        generate_layout=False,
+        generate_branchless=False,
+        generate_snapshot=False,
+        generate_decode_cache=False,
+        generate_fixp_kernels=False) -> str:
     """Generates library *.h file contents.
 
     Args:
@@ -147,47 +761,124 @@ def generate_lib_header(
         generate_getters (bool): generate safe getters for properties
         include_utils (bool): integrate utility code into file or use seperate file
         tab_spaces (int): Amount of spaces to use in generated code for tabs
+        generate_view (bool): generate view struct and accessors decoding properties on demand
+        generate_batch (bool): generate function parsing multiple NFC memory dumps at once
+        generate_columns (bool): generate columnar storage struct and decoder for multiple payloads
+        generate_delta (bool): generate dirty flags and function determining changed byte ranges of payload
+        generate_layout (bool): generate table containing offsets, sizes and limits of properties
+        generate_branchless (bool): generate safe getters without branches and function clamping all properties at once
+        generate_snapshot (bool): generate struct and functions sharing the configuration between threads with a sequence lock
+        generate_decode_cache (bool): generate LRU cache of decoded payloads and parsing functions using it
+        generate_fixp_kernels (bool): generate inline fixed point arithmetic specialized to the scales of fixed point properties
 
     Returns:
         str: Content of the generated *.h file
     """
 
-    if tab_spaces is not None:
-        properties.TAB_SPACES = tab_spaces
-    else:
-        tab_spaces = properties.TAB_SPACES
-    namespace = lib_name
-    data_struct_name = f"{lib_name}_config"
-    if include_utils:
-        utils_h = _get_utils_h()
-    else:
-        utils_h = f"\n#include \"{UTILS_H_FILENAME}\"\n"
-    struct_content = "".join(NONE_FILTER([prop.generate_struct_member() for prop in props]))
-    enum_snippet = ""
-    if generate_enums:
-        enums = [prop.generate_enums() for prop in props]
-        enum_snippet = "\n".join(NONE_FILTER(enums))
-    getter_snippet = ""
-    if generate_getters:
-        getters = [_build_getter_signature(prop) for prop in props]
-        getter_snippet = "\n".join(NONE_FILTER(getters))
-    lib_h_content = LIB_H_TEMPLATE.format(
-        tab=(" " * tab_spaces),
-        namespace=namespace,
-        utils_include=utils_h,
-        data_len=sum(map(lambda p: p.get_data_size(), props)) + 8, # Add 8 for last written timestamp
-        data_struct_content=struct_content,
-        data_struct_name=data_struct_name,
-        enums=enum_snippet,
-        getters=getter_snippet)
-    return lib_h_content
+    with properties.generator_settings(tab_spaces=tab_spaces, branchless_getters=generate_branchless):
+        tab_spaces = properties.get_tab_spaces()
+        namespace = lib_name
+        data_struct_name = f"{lib_name}_config"
+        if include_utils:
+            utils_h = _get_utils_h()
+        else:
+            utils_h = f"\n#include \"{UTILS_H_FILENAME}\"\n"
+        struct_content = "".join(NONE_FILTER([prop.generate_struct_member() for prop in props]))
+        enum_snippet = ""
+        if generate_enums:
+            enums = [prop.generate_enums() for prop in props]
+            enum_snippet = "\n".join(NONE_FILTER(enums))
+        getter_snippet = ""
+        if generate_getters or generate_branchless:
+            getters = [_build_getter_signature(prop) for prop in props]
+            getter_snippet = "\n".join(NONE_FILTER(getters))
+        if generate_branchless:
+            getter_snippet += LIB_H_CLAMP_TEMPLATE.format(data_struct_name=data_struct_name)
+        data_len = sum(map(lambda p: p.get_data_size(), props)) + 8 # Add 8 for last written timestamp
+        view_snippet = ""
+        if generate_view:
+            view_snippet = _build_view_header(props, lib_name, data_len - 8, tab_spaces)
+        batch_snippet = ""
+        if generate_batch:
+            batch_snippet = LIB_H_BATCH_TEMPLATE.format(
+                tab=(" " * tab_spaces),
+                data_struct_name=data_struct_name)
+        columns_snippet = ""
+        if generate_columns:
+            members = [prop.generate_column_member([]) for prop in props]
+            columns_snippet = LIB_H_COLUMNS_TEMPLATE.format(
+                tab=(" " * tab_spaces),
+                columns_struct_name=f"{lib_name}_columns",
+                column_members="".join(NONE_FILTER(members)))
+        dirty_member = ""
+        delta_snippet = ""
+        if generate_delta:
+            delta_ranges = _get_delta_ranges(props)
+            dirty_member = (" " * tab_spaces) + f"uint8_t dirty[{(len(delta_ranges) + 7) // 8}];\n"
+            dirty_indices = [f"#define {name} {i}\n" for i, (name, _, _) in enumerate(delta_ranges)]
+            delta_snippet = LIB_H_DELTA_TEMPLATE.format(
+                tab=(" " * tab_spaces),
+                data_struct_name=data_struct_name,
+                dirty_count=len(delta_ranges),
+                dirty_indices="".join(dirty_indices))
+        layout_snippet = ""
+        if generate_layout:
+            entries = _get_layout_entries(props)
+            layout_snippet = LIB_H_LAYOUT_TEMPLATE.format(
+                layout_count=len(entries),
+                layout_indices=_build_layout_indices(entries, "#define {name} {index}\n"))
+        snapshot_snippet = ""
+        if generate_snapshot:
+            snapshot_snippet = LIB_H_SNAPSHOT_TEMPLATE.format(
+                tab=(" " * tab_spaces),
+                data_struct_name=data_struct_name,
+                snapshot_struct_name=f"{lib_name}_config_snapshot")
+        decode_cache_snippet = ""
+        if generate_decode_cache:
+            decode_cache_snippet = LIB_H_DECODE_CACHE_TEMPLATE.format(
+                tab=(" " * tab_spaces),
+                data_struct_name=data_struct_name,
+                cache_name=f"{lib_name}_decode_cache",
+                cache_entry_name=f"{lib_name}_cache_entry")
+        fixp_kernels_snippet = ""
+        if generate_fixp_kernels:
+            kernels = [prop.generate_fixp_kernel_code() for prop in props]
+            fixp_kernels_snippet = "".join("\n" + kernel for kernel in NONE_FILTER(kernels))
+        lib_h_content = LIB_H_TEMPLATE.format(
+            tab=(" " * tab_spaces),
+            namespace=namespace,
+            utils_include=utils_h,
+            data_len=data_len,
+            data_struct_content=struct_content,
+            data_struct_name=data_struct_name,
+            enums=enum_snippet,
+            getters=getter_snippet,
+            view=view_snippet,
+            batch=batch_snippet,
+            columns=columns_snippet,
+            dirty_member=dirty_member,
+            delta=delta_snippet,
+            layout=layout_snippet,
+            snapshot=snapshot_snippet,
+            decode_cache=decode_cache_snippet,
+            fixp_kernels=fixp_kernels_snippet)
+        return lib_h_content
 
 def generate_lib_code(
         props,
         lib_name,
         generate_getters=False,
         include_utils=True,
-        tab_spaces=None) -> str:
+        tab_spaces=None,
+        generate_view=False,
+        generate_batch=False,
+        generate_columns=False,
+        generate_delta=False,
+        generate_layout=False,
+        generate_branchless=False,
+        array_unroll_threshold=None,
+        generate_snapshot=False,
+        generate_decode_cache=False) -> str:
     """Generates library *.c file contents.
 
     Args:
@@ -196,46 +887,189 @@ def generate_lib_code(
         generate_getters (bool): generate safe getters for properties
         include_utils (bool): integrate utility code into file or use seperate file
         tab_spaces (int): Amount of spaces to use in generated code for tabs
+        generate_view (bool): generate view struct and accessors decoding properties on demand
+        generate_batch (bool): generate function parsing multiple NFC memory dumps at once
+        generate_columns (bool): generate columnar storage struct and decoder for multiple payloads
+        generate_delta (bool): generate dirty flags and function determining changed byte ranges of payload
+        generate_layout (bool): generate table containing offsets, sizes and limits of properties
+        generate_branchless (bool): generate safe getters without branches and function clamping all properties at once
+        array_unroll_threshold (int): maximum number of array entries to unroll parsing and generation code for
+        generate_snapshot (bool): generate functions sharing the configuration between threads with a sequence lock
+        generate_decode_cache (bool): generate parsing functions reusing decoded payloads from an LRU cache
 
     Returns:
         str: Content of the generated *.c file
     """
 
-    if tab_spaces is not None:
-        properties.TAB_SPACES = tab_spaces
-    else:
-        tab_spaces = properties.TAB_SPACES
-    h_filename = H_FILENAME_TEMPLATE.format(lib_name=lib_name)
-    data_struct_name = f"{lib_name}_config"
-    data_index = 0
-    data_read_snippet = []
-    data_write_snippet = []
-    for prop in props:
-        data_read_snippet.append(prop.generate_read_code(data_index, "config->"))
-        data_write_snippet.append(prop.generate_write_code(data_index, "config->"))
-        data_index += prop.get_data_size()
-    data_read_snippet.append((" " * tab_spaces) + f"config->data_last_written_timestamp = bytes_to_time_point(buf + {data_index});\n")
-    data_write_snippet.append((" " * tab_spaces) + f"time_point_to_bytes(config->data_last_written_timestamp, buf + {data_index});\n")
-    data_read_snippet = "".join(NONE_FILTER(data_read_snippet))
-    data_write_snippet = "".join(NONE_FILTER(data_write_snippet))
-    utils_c = ""
-    if include_utils:
-        utils_c = _get_utils_c()
-    getter_snippet = ""
-    if generate_getters:
-        getters = [_build_getter_function(prop) for prop in props]
-        getter_snippet = "\n".join(NONE_FILTER(getters))
-    data_index += 8 # Add 8 for last written timestamp
-    lib_c_content = LIB_C_TEMPLATE.format(
-        tab=(" " * tab_spaces),
-        h_filename=h_filename,
-        utils_include=utils_c,
-        data_struct_name=data_struct_name,
-        data_length=str(data_index),
-        data_parsing_snippet=data_read_snippet,
-        data_generation_snippet=data_write_snippet,
-        getters=getter_snippet)
-    return lib_c_content
+    with properties.generator_settings(
+            tab_spaces=tab_spaces,
+            branchless_getters=generate_branchless,
+            array_unroll_threshold=array_unroll_threshold):
+        tab_spaces = properties.get_tab_spaces()
+        h_filename = H_FILENAME_TEMPLATE.format(lib_name=lib_name)
+        data_struct_name = f"{lib_name}_config"
+        data_index = 0
+        data_read_snippet = []
+        data_write_snippet = []
+        for prop in props:
+            data_read_snippet.append(prop.generate_read_code(data_index, "config->"))
+            data_write_snippet.append(prop.generate_write_code(data_index, "config->"))
+            data_index += prop.get_data_size()
+        data_read_snippet.append((" " * tab_spaces) + f"config->data_last_written_timestamp = bytes_to_time_point(buf + {data_index});\n")
+        data_write_snippet.append((" " * tab_spaces) + f"time_point_to_bytes(config->data_last_written_timestamp, buf + {data_index});\n")
+        data_read_snippet = "".join(NONE_FILTER(data_read_snippet))
+        data_write_snippet = "".join(NONE_FILTER(data_write_snippet))
+        utils_c = ""
+        if include_utils:
+            utils_c = _get_utils_c()
+        getter_snippet = ""
+        if generate_getters or generate_branchless:
+            getters = [_build_getter_function(prop) for prop in props]
+            getter_snippet = "\n".join(NONE_FILTER(getters))
+        if generate_branchless:
+            clamps = "".join(NONE_FILTER([prop.generate_clamp_code("config->", 1) for prop in props]))
+            if len(clamps) == 0:
+                clamps = (" " * tab_spaces) + "(void) config;\n"
+            getter_snippet += LIB_C_CLAMP_TEMPLATE.format(
+                data_struct_name=data_struct_name,
+                clamp_snippet=clamps)
+        data_index += 8 # Add 8 for last written timestamp
+        view_snippet = ""
+        if generate_view:
+            view_snippet = LIB_C_VIEW_TEMPLATE.format(
+                tab=(" " * tab_spaces),
+                view_struct_name=f"{lib_name}_view",
+                data_length=str(data_index))
+        batch_snippet = ""
+        if generate_batch:
+            batch_snippet = LIB_C_BATCH_TEMPLATE.format(
+                tab=(" " * tab_spaces),
+                data_struct_name=data_struct_name)
+        columns_snippet = ""
+        if generate_columns:
+            columns_snippet = _build_columns_code(props, lib_name, tab_spaces)
+        delta_snippet = ""
+        if generate_delta:
+            ranges = [(" " * tab_spaces) + f"{{{offset}, {size}}}, // {name}\n" for name, offset, size in _get_delta_ranges(props)]
+            delta_snippet = LIB_C_DELTA_TEMPLATE.format(
+                tab=(" " * tab_spaces),
+                data_struct_name=data_struct_name,
+                property_ranges="".join(ranges))
+        layout_snippet = ""
+        if generate_layout:
+            layout_snippet = LIB_C_LAYOUT_TEMPLATE.format(
+                layout_entries=_build_layout_rows(_get_layout_entries(props), tab_spaces, "LAYOUT_FLAG_"))
+        snapshot_snippet = ""
+        if generate_snapshot:
+            snapshot_snippet = LIB_C_SNAPSHOT_TEMPLATE.format(
+                tab=(" " * tab_spaces),
+                data_struct_name=data_struct_name,
+                snapshot_struct_name=f"{lib_name}_config_snapshot")
+        decode_cache_snippet = ""
+        if generate_decode_cache:
+            decode_cache_snippet = LIB_C_DECODE_CACHE_TEMPLATE.format(
+                tab=(" " * tab_spaces),
+                data_struct_name=data_struct_name,
+                cache_name=f"{lib_name}_decode_cache",
+                cache_entry_name=f"{lib_name}_cache_entry")
+        lib_c_content = LIB_C_TEMPLATE.format(
+            tab=(" " * tab_spaces),
+            h_filename=h_filename,
+            utils_include=utils_c,
+            data_struct_name=data_struct_name,
+            data_length=str(data_index),
+            data_parsing_snippet=data_read_snippet,
+            data_generation_snippet=data_write_snippet,
+            getters=getter_snippet,
+            view=view_snippet,
+            batch=batch_snippet,
+            columns=columns_snippet,
+            delta=delta_snippet,
+            layout=layout_snippet,
+            snapshot=snapshot_snippet,
+            decode_cache=decode_cache_snippet)
+        return lib_c_content
+
+def generate_layout_header(props, lib_name, tab_spaces=None) -> str:
+    """Generates C++ header file contents containing the property layout table as `constexpr` data.
+
+    Args:
+        props (list): configuration properties
+        lib_name (str): Name of the library
+        tab_spaces (int): Amount of spaces to use in generated code for tabs
+
+    Returns:
+        str: Content of the generated *.hpp file
+    """
+
+    with properties.generator_settings(tab_spaces=tab_spaces):
+        tab_spaces = properties.get_tab_spaces()
+        entries = _get_layout_entries(props)
+        data_len = sum(map(lambda p: p.get_data_size(), props)) + 8 # Add 8 for last written timestamp
+        return LIB_HPP_LAYOUT_TEMPLATE.format(
+            tab=(" " * tab_spaces),
+            namespace=lib_name,
+            data_len=data_len,
+            layout_count=len(entries),
+            layout_flags="".join(f"constexpr std::uint8_t FLAG_{name} = 0x{value:02X};\n" for name, value, _ in LAYOUT_FLAGS),
+            layout_indices=_build_layout_indices(entries, "constexpr std::size_t {name} = {index};\n"),
+            layout_entries=_build_layout_rows(entries, tab_spaces, "FLAG_"))
+
+def generate_lib_cpp_header(
+        props,
+        lib_name,
+        generate_enums=False,
+        include_utils=True,
+        tab_spaces=None) -> str:
+    """Generates header-only C++17 library contents.
+
+    Args:
+        props (list): configuration properties
+        lib_name (str): Name of the library
+        generate_enums (bool): generate enums for property options
+        include_utils (bool): integrate utility code into file or use seperate file
+        tab_spaces (int): Amount of spaces to use in generated code for tabs
+
+    Returns:
+        str: Content of the generated *.hpp file
+    """
+
+    with properties.generator_settings(tab_spaces=tab_spaces):
+        tab_spaces = properties.get_tab_spaces()
+        if include_utils:
+            utils_hpp = _get_utils_hpp()
+        else:
+            utils_hpp = f"\n#include \"{UTILS_HPP_FILENAME}\"\n"
+        struct_content = "".join(NONE_FILTER([prop.generate_cpp_member() for prop in props]))
+        enum_snippet = ""
+        if generate_enums:
+            enums = [prop.generate_enums() for prop in props]
+            enum_snippet = "\n".join(NONE_FILTER(enums))
+        data_index = 0
+        fields = []
+        decode_lines = []
+        encode_lines = []
+        for prop in props:
+            fields.append(prop.generate_cpp_field(data_index))
+            decode_lines.append(prop.generate_cpp_decode_code("fields::", "payload", "cfg.", 1))
+            encode_lines.append(prop.generate_cpp_encode_code("fields::", "payload", "cfg.", 1))
+            data_index += prop.get_data_size()
+        tab = " " * tab_spaces
+        decode_lines.append(
+            f"{tab}cfg.data_last_written_timestamp = fields::data_last_written_timestamp::decode(payload);\n")
+        encode_lines.append(
+            f"{tab}fields::data_last_written_timestamp::encode(cfg.data_last_written_timestamp, payload);\n")
+        return LIB_HPP_TEMPLATE.format(
+            tab=tab,
+            namespace=lib_name,
+            utils_include=utils_hpp,
+            data_struct_content=struct_content,
+            enums=enum_snippet,
+            data_len=data_index + 8, # Add 8 for last written timestamp
+            fields="".join(NONE_FILTER(fields)),
+            timestamp_index=data_index,
+            decode_snippet="".join(NONE_FILTER(decode_lines)),
+            encode_snippet="".join(NONE_FILTER(encode_lines)))
 
 def copy_utils(destination) -> None:
     """Copy C utility library files to `destination`
@@ -244,8 +1078,8 @@ def copy_utils(destination) -> None:
         destination (str): destination folder
     """
     res = files("eputgen")
-    contents_h = (res / "eputgen" / UTILS_H_FILENAME).read_text()
-    contents_c = (res / "eputgen" / UTILS_C_FILENAME).read_text()
+    contents_h = (res / "c" / UTILS_H_FILENAME).read_text()
+    contents_c = (res / "c" / UTILS_C_FILENAME).read_text()
     if not destination.endswith(sep):
         destination = destination + sep
     with open(destination + UTILS_H_FILENAME, "w") as file_h:
@@ -253,6 +1087,19 @@ def copy_utils(destination) -> None:
     with open(destination + UTILS_C_FILENAME, "w") as file_c:
         file_c.write(contents_c)
 
+def copy_cpp_utils(destination) -> None:
+    """Copy C++ utility header to `destination`
+
+    Args:
+        destination (str): destination folder
+    """
+    res = files("eputgen")
+    contents_hpp = (res / "cpp" / UTILS_HPP_FILENAME).read_text()
+    if not destination.endswith(sep):
+        destination = destination + sep
+    with open(destination + UTILS_HPP_FILENAME, "w") as file_hpp:
+        file_hpp.write(contents_hpp)
+
 def _build_getter_function(prop):
     getter = prop.generate_safe_getter_code()
     if getter is None:
@@ -265,6 +1112,96 @@ def _build_getter_signature(prop):
         return None
     return getter[0]
 
+def _build_view_header(props, lib_name, timestamp_index, tab_spaces):
+    view_struct_name = f"{lib_name}_view"
+    data_index = 0
+    getters = []
+    for prop in props:
+        getters.append(prop.generate_view_getter_code(str(data_index), view_struct_name, ""))
+        data_index += prop.get_data_size()
+    return LIB_H_VIEW_TEMPLATE.format(
+        tab=(" " * tab_spaces),
+        view_struct_name=view_struct_name,
+        view_getters="\n".join(NONE_FILTER(getters)),
+        timestamp_index=timestamp_index)
+
+def _build_columns_code(props, lib_name, tab_spaces):
+    data_index = 0
+    column_reads = []
+    for prop in props:
+        column_reads.append(prop.generate_column_read_code(str(data_index), []))
+        data_index += prop.get_data_size()
+    tab = " " * tab_spaces
+    column_reads.append(
+        f"{tab}if (columns->data_last_written_timestamp != NULL) {{\n" +
+        f"{tab}{tab}for (size_t i = 0; i < n; i++) {{\n" +
+        f"{tab}{tab}{tab}columns->data_last_written_timestamp[i] = " +
+        f"bytes_to_time_point(payloads + i * DATA_PAYLOAD_LENGTH + {data_index});\n" +
+        f"{tab}{tab}}}\n" +
+        f"{tab}}}\n")
+    return LIB_C_COLUMNS_TEMPLATE.format(
+        tab=tab,
+        columns_struct_name=f"{lib_name}_columns",
+        column_parsing_snippet="".join(NONE_FILTER(column_reads)))
+
+def _get_delta_ranges(props):
+    data_index = 0
+    ranges = []
+    for prop in props:
+        size = prop.get_data_size()
+        if size > 0:
+            ranges.append((f"DIRTY_{prop.identifier.upper()}", data_index, size))
+        data_index += size
+    ranges.append(("DIRTY_DATA_LAST_WRITTEN_TIMESTAMP", data_index, 8))
+    return ranges
+
+def _get_layout_entries(props):
+    data_index = 0
+    entries = []
+    for prop in props:
+        prop.generate_layout_entries(data_index, -1, entries)
+        data_index += prop.get_data_size()
+    return entries
+
+def _build_layout_indices(entries, template):
+    return "".join(
+        template.format(name=f"LAYOUT_{entry['id'].upper()}", index=i) for i, entry in enumerate(entries))
+
+def _c_int64(val):
+    if val is None:
+        return "INT64_C(0)"
+    elif val > 0x7FFFFFFFFFFFFFFF:
+        # uint64_t limits are stored as two's complement
+        return f"(int64_t) UINT64_C({val})"
+    elif val == -0x8000000000000000:
+        return "INT64_MIN"
+    return f"INT64_C({val})"
+
+def _build_layout_rows(entries, tab_spaces, flag_prefix):
+    rows = []
+    for entry in entries:
+        # Limits may be 0, only missing ones are None
+        flags = [flag_prefix + name for name, _, key in LAYOUT_FLAGS if entry[key] is not None and entry[key] is not False]
+        if entry["float"]:
+            int_limits = [None, None, None]
+            float_limits = [float(entry[key] or 0) for key in ["min", "max", "step"]]
+        else:
+            int_limits = [entry["min"], entry["max"], entry["step"]]
+            float_limits = [0.0, 0.0, 0.0]
+        fields = [
+            f"\"{entry['id']}\"",
+            str(entry["parent"]),
+            f"0x{entry['code']:02X}",
+            " | ".join(flags) if len(flags) > 0 else "0",
+            str(entry["offset"]),
+            str(entry["size"]),
+            str(entry["count"])]
+        fields.extend(_c_int64(val) for val in int_limits)
+        fields.extend(repr(val) for val in float_limits)
+        fields.append(str(entry["scale"]))
+        rows.append((" " * tab_spaces) + "{" + ", ".join(fields) + "},\n")
+    return "".join(rows)
+
 def _get_utils_h() -> str:
     res = files("eputgen")
     with open(res / "c" / UTILS_H_FILENAME, "r") as file:
@@ -272,6 +1209,13 @@ def _get_utils_h() -> str:
         lines = lines[2:-2]
         return "".join(lines)
 
+def _get_utils_hpp() -> str:
+    res = files("eputgen")
+    with open(res / "cpp" / UTILS_HPP_FILENAME, "r") as file:
+        lines = file.readlines()
+        lines = lines[2:-2]
+        return "".join(lines)
+
 def _get_utils_c() -> str:
     res = files("eputgen")
     with open(res / "c" / UTILS_C_FILENAME, "r") as file:
@@ -2,6 +2,7 @@
 """
 
 import argparse
+from pathlib import Path
 from . import export
 
 def main():
@@ -48,6 +49,72 @@ def main():
         action="store_true",
         default=False,
         help="generate safe getter functions for properties")
+    parser.add_argument(
+        "--view",
+        dest="generate_view",
+        action="store_true",
+        default=False,
+        help="generate payload view with accessors decoding properties on demand")
+    parser.add_argument(
+        "--batch",
+        dest="generate_batch",
+        action="store_true",
+        default=False,
+        help="generate function parsing multiple NFC memory dumps at once")
+    parser.add_argument(
+        "--columns",
+        dest="generate_columns",
+        action="store_true",
+        default=False,
+        help="generate columnar storage and decoder for multiple payloads")
+    parser.add_argument(
+        "--delta",
+        dest="generate_delta",
+        action="store_true",
+        default=False,
+        help="generate dirty flags and function determining changed byte ranges of payload")
+    parser.add_argument(
+        "--layout",
+        dest="generate_layout",
+        action="store_true",
+        default=False,
+        help="generate table and C++ header containing offsets, sizes and limits of properties")
+    parser.add_argument(
+        "--cpp",
+        dest="generate_cpp",
+        action="store_true",
+        default=False,
+        help="generate header-only C++17 library in addition to C library")
+    parser.add_argument(
+        "--branchless",
+        dest="generate_branchless",
+        action="store_true",
+        default=False,
+        help="generate safe getters without branches and function clamping all properties at once")
+    parser.add_argument(
+        "--snapshot",
+        dest="generate_snapshot",
+        action="store_true",
+        default=False,
+        help="generate lock-free snapshot publishing the configuration from one writer to many reader threads")
+    parser.add_argument(
+        "--decode-cache",
+        dest="generate_decode_cache",
+        action="store_true",
+        default=False,
+        help="generate LRU cache of decoded payloads and parsing functions reusing them")
+    parser.add_argument(
+        "--fixp-kernels",
+        dest="generate_fixp_kernels",
+        action="store_true",
+        default=False,
+        help="generate inline fixed point arithmetic specialized to the scale of each fixed point property")
+    parser.add_argument(
+        "--unroll-threshold",
+        dest="array_unroll_threshold",
+        type=int,
+        default=None,
+        help="maximum number of array entries to unroll parsing and generation code for, larger arrays use loops")
     parser.add_argument(
         "--include-utils",
         dest="include_utils",
@@ -61,6 +128,29 @@ def main():
         default=True,
         help="compress metadata with deflate algorithm"
     )
+    parser.add_argument(
+        "--dict",
+        dest="dictionary_file",
+        default=None,
+        help="preset dictionary to compress metadata with - remember to add 'dict' argument to NDEF metadata type URI")
+    parser.add_argument(
+        "--train-dict",
+        dest="train_dictionary",
+        action="store_true",
+        default=False,
+        help="train preset dictionary for metadata compression on all descriptors in input folder")
+    parser.add_argument(
+        "--dict-size",
+        dest="dictionary_size",
+        type=int,
+        default=export.DICTIONARY_SIZE,
+        help="maximum size of dictionary trained with --train-dict")
+    parser.add_argument(
+        "--indexed-translations",
+        dest="indexed_translations",
+        action="store_true",
+        default=False,
+        help="serialize translations with offset tables, allowing lookups of single strings in uncompressed metadata")
     parser.add_argument(
         "--tag-size",
         dest="tag_size",
@@ -68,17 +158,56 @@ def main():
         default=-1,
         help="memory size of used NFC tag - if set, a warning will be shown if generated files are too large for tag"
     )
+    parser.add_argument(
+        "--multi",
+        dest="export_multi",
+        action="store_true",
+        default=False,
+        help="export all descriptors in input folder in parallel into subfolders named after each descriptor, skipping unchanged ones; "
+            "with --rom, export one ROM image containing all descriptors in input folder")
+    parser.add_argument(
+        "--jobs",
+        dest="jobs",
+        type=int,
+        default=None,
+        help="number of processes to use with --multi - defaults to number of processors")
+    parser.add_argument(
+        "--cache",
+        dest="cache_path",
+        default=None,
+        help="folder to store exports in for reuse with --multi - defaults to a folder in output folder")
+    parser.add_argument(
+        "--schema-cache",
+        dest="schema_cache",
+        default=None,
+        help="folder to store compiled descriptors in, later exports of unchanged descriptors skip parsing them")
     parser.add_argument(
         "input_path",
-        help="input device descriptor file")
+        help="input device descriptor file or folder of descriptor files with --multi or --train-dict")
     parser.add_argument(
         "output_path",
         help="output folder")
     parser.add_argument(
         "lib_name",
-        help="name of generated C-library")
+        nargs="?",
+        default=None,
+        help="name of generated C-library - not used with --multi or --train-dict")
     args = parser.parse_args()
-    if args.generate_rom:
+    if not args.generate_rom and not args.export_multi and not args.train_dictionary and args.lib_name is None:
+        parser.error("lib_name is required")
+    dictionary = None
+    if args.dictionary_file is not None:
+        with open(args.dictionary_file, "rb") as file:
+            dictionary = file.read()
+    if args.train_dictionary:
+        config_files = sorted(str(path) for path in Path(args.input_path).glob("*.yaml"))
+        dictionary_id = export.export_dictionary(
+            config_files,
+            args.output_path,
+            size=args.dictionary_size,
+            schema_cache=args.schema_cache)
+        print(f"Trained dictionary {dictionary_id:08x} on {len(config_files)} descriptors")
+    elif args.generate_rom:
         translation_sets = None
         if args.language_sets is not None:
             translation_sets = [l.split(",") for l in args.language_sets]
@@ -91,22 +220,74 @@ def main():
             hash_func = export.HASH_SHA256
         if args.hash_func.lower() == "crc32":
             hash_func = export.HASH_CRC32
-        export.export_rom_blob(
-            args.input_path,
-            args.output_path,
-            translation_sets,
-            args.compress_metadata,
-            hash_func,
-            tag_size=args.tag_size
-        )
+        if args.export_multi:
+            config_files = sorted(str(path) for path in Path(args.input_path).glob("*.yaml"))
+            saved = export.export_rom_image(
+                config_files,
+                args.output_path,
+                translation_sets,
+                args.compress_metadata,
+                hash_func,
+                tag_size=args.tag_size,
+                dictionary=dictionary,
+                indexed_translations=args.indexed_translations,
+                schema_cache=args.schema_cache
+            )
+            blobs_per_descriptor = 1 + (len(translation_sets) if translation_sets is not None else 1)
+            for index, config_file in enumerate(config_files):
+                print(f"{Path(config_file).stem}: data blob at index {index * blobs_per_descriptor}")
+            print(f"Saved {saved} bytes by storing identical blobs once")
+        else:
+            export.export_rom_blob(
+                args.input_path,
+                args.output_path,
+                translation_sets,
+                args.compress_metadata,
+                hash_func,
+                tag_size=args.tag_size,
+                dictionary=dictionary,
+                indexed_translations=args.indexed_translations,
+                schema_cache=args.schema_cache
+            )
     else:
-        export.export_all(
-            args.input_path,
-            args.output_path,
-            args.lib_name,
-            compress_metadata=args.compress_metadata,
-            generate_enums=args.generate_enums,
-            generate_getters=args.generate_getters,
-            include_utils=args.include_utils,
-            tag_size=args.tag_size,
-            tab_spaces=args.tab_spaces)
+        options = {
+            "generate_enums": args.generate_enums,
+            "generate_getters": args.generate_getters,
+            "include_utils": args.include_utils,
+            "tag_size": args.tag_size,
+            "tab_spaces": args.tab_spaces,
+            "generate_view": args.generate_view,
+            "generate_batch": args.generate_batch,
+            "generate_columns": args.generate_columns,
+            "generate_delta": args.generate_delta,
+            "generate_layout": args.generate_layout,
+            "generate_cpp": args.generate_cpp,
+            "generate_branchless": args.generate_branchless,
+            "dictionary": dictionary,
+            "indexed_translations": args.indexed_translations,
+            "array_unroll_threshold": args.array_unroll_threshold,
+            "generate_snapshot": args.generate_snapshot,
+            "generate_decode_cache": args.generate_decode_cache,
+            "generate_fixp_kernels": args.generate_fixp_kernels
+        }
+        if args.export_multi:
+            config_files = sorted(str(path) for path in Path(args.input_path).glob("*.yaml"))
+            results = export.export_batch(
+                config_files,
+                args.output_path,
+                args.compress_metadata,
+                cache_path=args.cache_path,
+                jobs=args.jobs,
+                schema_cache=args.schema_cache,
+                **options)
+            for status in ["generated", "cached", "unchanged"]:
+                count = sum(1 for result in results.values() if result == status)
+                print(f"{count} {status}")
+        else:
+            export.export_all(
+                args.input_path,
+                args.output_path,
+                args.lib_name,
+                compress_metadata=args.compress_metadata,
+                schema_cache=args.schema_cache,
+                **options)
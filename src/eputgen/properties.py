@@ -1,6 +1,8 @@
 """Provides classes for processing YAML descriptors.
 """
 
+import contextlib
+import contextvars
 import math
 from datetime import datetime
 import struct
@@ -10,6 +12,50 @@ from strictyaml import YAML
 from .util import serialize_ascii, error, serialize_utf8, warn
 
 TAB_SPACES = 4
+# Safe getters of integer properties select limits with masks instead of branches
+BRANCHLESS_GETTERS = False
+# Arrays with more entries are parsed and generated in a loop instead of unrolled code
+ARRAY_UNROLL_THRESHOLD = 4
+
+# Overrides of the settings above for the generation running in the current thread or task
+_SETTINGS = contextvars.ContextVar("eputgen_settings", default={})
+
+def _setting(name: str):
+    return _SETTINGS.get().get(name, globals()[name])
+
+def get_tab_spaces() -> int:
+    """Get the number of spaces used for tabs in code generated in the current context.
+
+    Returns:
+        int: number of spaces
+    """
+
+    return _setting("TAB_SPACES")
+
+@contextlib.contextmanager
+def generator_settings(tab_spaces=None, branchless_getters=None, array_unroll_threshold=None):
+    """Override code generation settings for the current thread or asyncio task.
+    Settings that are None keep their current value, by default TAB_SPACES, BRANCHLESS_GETTERS and
+    ARRAY_UNROLL_THRESHOLD. Generation in other threads is not affected, so libraries can be generated concurrently.
+
+    Args:
+        tab_spaces (int): number of spaces to use for tabs in generated code
+        branchless_getters (bool): select limits in safe getters of integer properties with masks
+        array_unroll_threshold (int): maximum number of array entries to unroll parsing and generation code for
+    """
+
+    settings = dict(_SETTINGS.get())
+    overrides = {
+        "TAB_SPACES": tab_spaces,
+        "BRANCHLESS_GETTERS": branchless_getters,
+        "ARRAY_UNROLL_THRESHOLD": array_unroll_threshold
+    }
+    settings.update({name: value for name, value in overrides.items() if value is not None})
+    token = _SETTINGS.set(settings)
+    try:
+        yield
+    finally:
+        _SETTINGS.reset(token)
 
 TYPE_KEY = "type"
 ID_KEY = "id"
@@ -41,15 +87,172 @@ WRITE_TEMPLATE = \
 SAFE_GETTER_TEMPLATE = \
     "{rtype} get_{name}({rtype} {name})"
 
+VIEW_GETTER_TEMPLATE = \
+    "static inline {rtype}view_get_{name}({view_type} *view{params})"
+
 def _add_ascii(data: list, string: str) -> None:
     data.extend(serialize_ascii(string))
 
 def _tab(depth: int = 1) -> str:
-    return " " * TAB_SPACES * depth
+    return " " * _setting("TAB_SPACES") * depth
+
+def _add_offset(index, offset: int):
+    # Indices inside array loops are C expressions
+    if isinstance(index, int):
+        return index + offset
+    if offset == 0:
+        return index
+    return f"{index} + {offset}"
+
+def _indent(code: str) -> str:
+    return "".join(_tab() + line for line in code.splitlines(True))
 
 def _to_short_bytes(val: int) -> bytes:
     return val.to_bytes(length=2, byteorder="big", signed=False)
 
+def _view_getter(name: str, rtype: str, view_type: str, params: str, expression: str) -> str:
+    if not rtype.endswith("*"):
+        rtype += " "
+    signature = VIEW_GETTER_TEMPLATE.format(
+        rtype=rtype,
+        name=name,
+        view_type=view_type,
+        params=params)
+    return f"{signature} {{\n{_tab()}return {expression};\n}}\n"
+
+def _column_member(name: str, type_name: str, dims: str) -> str:
+    if len(dims) > 0:
+        return _tab() + f"{type_name} (*{name}){dims};\n"
+    return _tab() + f"{type_name} *{name};\n"
+
+def _column_read(name: str, loops: list, statements) -> str:
+    # statements creates the innermost lines from the accessed column element
+    lines = [_tab() + f"if (columns->{name} != NULL) {{\n"]
+    lines.append(_tab(2) + "for (size_t i = 0; i < n; i++) {\n")
+    for depth, (index, count) in enumerate(loops):
+        lines.append(_tab(3 + depth) + f"for (size_t {index} = 0; {index} < {count}; {index}++) {{\n")
+    target = f"columns->{name}[i]" + "".join(f"[{index}]" for index, _ in loops)
+    inner = _tab(3 + len(loops))
+    for line in statements(target):
+        lines.append(inner + line + "\n")
+    for depth in reversed(range(0, len(loops))):
+        lines.append(_tab(3 + depth) + "}\n")
+    lines.append(_tab(2) + "}\n")
+    lines.append(_tab() + "}\n")
+    return "".join(lines)
+
+def _column_source(offset: str) -> str:
+    return f"payloads + i * DATA_PAYLOAD_LENGTH + {offset}"
+
+def _column_converter_read(name: str, loops: list, offset: str, converter: str, extra_args: str = "") -> str:
+    return _column_read(
+        name,
+        loops,
+        lambda target: [f"{target} = {converter}({_column_source(offset)}{extra_args});"])
+
+def _copy_read(target: str, source: str, length: int, terminate: bool) -> list:
+    lines = [f"memcpy({target}, {source}, {length});"]
+    if terminate:
+        lines.append(f"{target}[{length}] = 0;")
+    return lines
+
+def _column_copy_read(name: str, loops: list, offset: str, length: int, terminate: bool) -> str:
+    return _column_read(
+        name,
+        loops,
+        lambda target: _copy_read(target, _column_source(offset), length, terminate))
+
+def _c_int_literal(val: int) -> str:
+    if -0x80000000 <= val <= 0x7FFFFFFF:
+        return str(val)
+    elif val > 0x7FFFFFFFFFFFFFFF:
+        return f"{val}ULL"
+    return f"{val}LL"
+
+def _c_uint_literal(val: int) -> str:
+    if val > 0xFFFFFFFF:
+        return f"{val}ULL"
+    return f"{val}u"
+
+def _reciprocal(divisor: int, bound: int) -> Tuple[int, int]:
+    # Multiplier and shift with (x * multiplier) >> shift == x / divisor for 0 <= x <= bound
+    shift = 0
+    while True:
+        multiplier = -(-(1 << shift) // divisor)
+        if (multiplier * divisor - (1 << shift)) * bound < (1 << shift):
+            return multiplier, shift
+        shift += 1
+
+def _loop_dims(loops: list) -> str:
+    return "".join(f"[{count}]" for _, count in loops)
+
+def _cpp_type_name(type_name: str) -> str:
+    if type_name in ["float", "double"]:
+        return type_name
+    elif type_name.endswith("_t"):
+        return "std::" + type_name
+    return "eput::" + type_name
+
+def _cpp_literal(val) -> str:
+    if isinstance(val, float):
+        return repr(val)
+    elif val == -0x8000000000000000:
+        return "(-9223372036854775807LL - 1)"
+    elif val > 0x7FFFFFFFFFFFFFFF:
+        return f"{val}ULL"
+    return str(val)
+
+def _cpp_limits(type_name: str, min_val, max_val, step_size) -> str:
+    values = []
+    for val in [min_val, max_val, step_size]:
+        values.append("false" if val is None else "true")
+        values.append("0" if val is None else _cpp_literal(val))
+    return f"static constexpr eput::limits<{type_name}> limits{{{', '.join(values)}}};"
+
+def _cpp_field(prop, descriptor: str, limits: str = None) -> str:
+    if limits is None:
+        return _tab(prop.depth) + f"using {prop.identifier} = {descriptor};\n"
+    return (_tab(prop.depth) + f"struct {prop.identifier} : {descriptor} {{\n" +
+            _tab(prop.depth + 1) + limits + "\n" +
+            _tab(prop.depth) + "};\n")
+
+def _join_safe_getters(sub_properties: list) -> Tuple[str, str]:
+    getters = [sub_prop.generate_safe_getter_code() for sub_prop in sub_properties]
+    getters = list(filter(lambda x: x is not None, getters))
+    if len(getters) > 0:
+        signatures = [getter[0] for getter in getters]
+        functions = [getter[1] for getter in getters]
+        signatures = "\n".join(signatures)
+        functions = "\n".join(functions)
+        return (signatures, functions)
+    return None
+
+def _layout_entry(
+        prop,
+        offset: int,
+        parent: int,
+        size: int = None,
+        count: int = 1,
+        min_val=None,
+        max_val=None,
+        step_size=None,
+        scale: int = 0,
+        is_float: bool = False,
+        is_bits: bool = False) -> dict:
+    return {
+        "id": prop.identifier,
+        "parent": parent,
+        "code": prop.code,
+        "offset": offset,
+        "size": prop.get_data_size() if size is None else size,
+        "count": count,
+        "min": min_val,
+        "max": max_val,
+        "step": step_size,
+        "scale": scale,
+        "float": is_float,
+        "bits": is_bits}
+
 class Property:
     """Base class for properties.
     Provides base implementations of all necessary methods.
@@ -73,6 +276,12 @@ class Property:
         else:
             self.identifier = None
 
+    def __getstate__(self) -> dict:
+        # The YAML representation is only used while constructing, pickled properties leave it out
+        state = self.__dict__.copy()
+        state["property"] = None
+        return state
+
     def get_data_size(self) -> int:
         """Return size of contained properties data in bytes.
 
@@ -125,7 +334,7 @@ class Property:
         """Generate C data parsing code for this property.
 
         Args:
-            current_index (int): Current index in byte array
+            current_index (int): Current index in byte array, a C expression inside array loops
             parent_member (str): Prefix to use for member access in C code
 
         Returns:
@@ -138,7 +347,7 @@ class Property:
         """Generate C data generation code for this property.
 
         Args:
-            current_index (int): Current index in byte array
+            current_index (int): Current index in byte array, a C expression inside array loops
             parent_member (str): Prefix to use for member access in C code
 
         Returns:
@@ -147,6 +356,36 @@ class Property:
 
         return None
 
+    def generate_array_read_code(self, current_index: int, first_member: str, count: int, stride: str) -> str:
+        """Generate C code parsing all entries of an array containing only this property with one bulk converter.
+
+        Args:
+            current_index (int): Index of the first entry in byte array
+            first_member (str): Member access of this property in the first entry
+            count (int): Number of entries
+            stride (str): C expression for the distance between two entries in the struct
+
+        Returns:
+            str: Generated code or None if entries have to be parsed individually
+        """
+
+        return None
+
+    def generate_array_write_code(self, current_index: int, first_member: str, count: int, stride: str) -> str:
+        """Generate C code generating all entries of an array containing only this property with one bulk converter.
+
+        Args:
+            current_index (int): Index of the first entry in byte array
+            first_member (str): Member access of this property in the first entry
+            count (int): Number of entries
+            stride (str): C expression for the distance between two entries in the struct
+
+        Returns:
+            str: Generated code or None if entries have to be generated individually
+        """
+
+        return None
+
     def generate_safe_getter_code(self) -> Tuple[str, str]:
         """Generate C code performing sanity checks on data of this property.
 
@@ -156,6 +395,146 @@ class Property:
         """
         return None
 
+    def generate_clamp_code(self, parent_member: str, depth: int) -> str:
+        """Generate C code replacing the value of this property by the result of its safe getter.
+
+        Args:
+            parent_member (str): Prefix to use for member access in C code
+            depth (int): Indentation depth of the generated code
+
+        Returns:
+            str: Generated code or None if there is no safe getter
+        """
+
+        if self.generate_safe_getter_code() is None:
+            return None
+        member = f"{parent_member}{self.identifier}"
+        return _tab(depth) + f"{member} = get_{self.identifier}({member});\n"
+
+    def generate_fixp_kernel_code(self) -> str:
+        """Generate inline C fixed point arithmetic specialized to the scale of this property.
+
+        Returns:
+            str: Generated code or None if this property has no fixed point values
+        """
+
+        return None
+
+    def generate_view_getter_code(self, offset: str, view_type: str, params: str) -> str:
+        """Generate C accessor decoding this property directly from a payload view.
+
+        Args:
+            offset (str): C expression for the index of the property in the payload
+            view_type (str): Name of the view struct
+            params (str): Additional parameters selecting array entries
+
+        Returns:
+            str: Generated code
+        """
+
+        return None
+
+    def generate_column_member(self, loops: list) -> str:
+        """Generate C member definitions of the columnar storage struct for this property.
+
+        Args:
+            loops (list): Index variable and entry count of every enclosing array
+
+        Returns:
+            str: Generated code
+        """
+
+        return None
+
+    def generate_column_read_code(self, offset: str, loops: list) -> str:
+        """Generate C code decoding this property from multiple payloads into its column.
+
+        Args:
+            offset (str): C expression for the index of the property in a payload
+            loops (list): Index variable and entry count of every enclosing array
+
+        Returns:
+            str: Generated code
+        """
+
+        return None
+
+    def _get_cpp_type(self) -> str:
+        return None
+
+    def generate_cpp_member(self) -> str:
+        """Generate C++ struct member definition for this property.
+
+        Returns:
+            str: Generated code or None
+        """
+
+        cpp_type = self._get_cpp_type()
+        if cpp_type is None:
+            return None
+        return _tab(self.depth) + f"{cpp_type} {self.identifier};\n"
+
+    def generate_cpp_field(self, offset: int) -> str:
+        """Generate C++ field descriptor for this property.
+
+        Args:
+            offset (int): Index of the property in the payload or in an entry of the parent array
+
+        Returns:
+            str: Generated code or None
+        """
+
+        cpp_type = self._get_cpp_type()
+        if cpp_type is None:
+            return None
+        return _cpp_field(self, f"eput::field<{offset}, {cpp_type}>")
+
+    def generate_cpp_decode_code(self, scope: str, payload: str, target: str, depth: int) -> str:
+        """Generate C++ code decoding this property with its field descriptor.
+
+        Args:
+            scope (str): Prefix to use for field descriptor access
+            payload (str): C++ expression for the span containing the property
+            target (str): Prefix to use for member access
+            depth (int): Number of tabs to insert before lines
+
+        Returns:
+            str: Generated code or None
+        """
+
+        if self._get_cpp_type() is None:
+            return None
+        return _tab(depth) + f"{target}{self.identifier} = {scope}{self.identifier}::decode({payload});\n"
+
+    def generate_cpp_encode_code(self, scope: str, payload: str, source: str, depth: int) -> str:
+        """Generate C++ code encoding this property with its field descriptor.
+
+        Args:
+            scope (str): Prefix to use for field descriptor access
+            payload (str): C++ expression for the span containing the property
+            source (str): Prefix to use for member access
+            depth (int): Number of tabs to insert before lines
+
+        Returns:
+            str: Generated code or None
+        """
+
+        if self._get_cpp_type() is None:
+            return None
+        return _tab(depth) + f"{scope}{self.identifier}::encode({source}{self.identifier}, {payload});\n"
+
+    def generate_layout_entries(self, offset: int, parent: int, entries: list) -> None:
+        """Append layout table entries describing this property to `entries`.
+
+        Args:
+            offset (int): Index of the property in the payload or in an entry of the parent array
+            parent (int): Index of the entry of the parent array in `entries`, -1 on top level
+            entries (list): Layout entries to append to
+        """
+
+        if self.get_data_size() > 0:
+            entries.append(_layout_entry(self, offset, parent))
+
 class Divider(Property):
     """Divider modifier property.
     """
@@ -235,6 +614,9 @@ class OneOutOfMProperty(Property):
     def serialize_data(self) -> list:
         return [self.default]
 
+    def _get_cpp_type(self) -> str:
+        return "std::uint8_t"
+
     def generate_struct_member(self) -> str:
         return _tab(self.depth) + f"uint8_t {self.identifier};\n"
 
@@ -256,6 +638,20 @@ class OneOutOfMProperty(Property):
             type_conversion_method="uint8_to_bytes",
             data_index=current_index)
 
+    def generate_view_getter_code(self, offset: str, view_type: str, params: str) -> str:
+        return _view_getter(
+            self.identifier,
+            "uint8_t",
+            view_type,
+            params,
+            f"bytes_to_uint8(view->buf + {offset})")
+
+    def generate_column_member(self, loops: list) -> str:
+        return _column_member(self.identifier, "uint8_t", _loop_dims(loops))
+
+    def generate_column_read_code(self, offset: str, loops: list) -> str:
+        return _column_converter_read(self.identifier, loops, offset, "bytes_to_uint8")
+
     def generate_safe_getter_code(self) -> Tuple[str, str]:
         entry_count = len(self.entries)
         signature = SAFE_GETTER_TEMPLATE.format(
@@ -309,7 +705,7 @@ class NOutOfMProperty(Property):
             default_entries = self.property[DEFAULT_KEY].data
             default_indices = map(self.entries.index, default_entries)
             for i in default_indices:
-                array_index = math.ceil(i / 8) - 1
+                array_index = i // 8
                 self.default[array_index] = self.default[array_index] | (1 << (i % 8))
 
     def get_data_size(self) -> int:
@@ -335,6 +731,9 @@ class NOutOfMProperty(Property):
     def serialize_data(self) -> list:
         return self.default
 
+    def _get_cpp_type(self) -> str:
+        return f"std::array<std::uint8_t, {self.get_data_size()}>"
+
     def generate_struct_member(self) -> str:
         return _tab(self.depth) + f"uint8_t {self.identifier}[{self.get_data_size()}];\n"
 
@@ -343,16 +742,47 @@ class NOutOfMProperty(Property):
         return "typedef enum {\n" + "".join(lines) + f"}} {self.identifier}_options;\n"
 
     def generate_read_code(self, current_index: int, parent_member: str) -> str:
-        return (_tab(1) + f"for (int i = 0; i < {self.get_data_size()}; i++) {{\n" +
-                _tab(2) +
-                f"{parent_member}{self.identifier}[i] = *(buf + {current_index} + i);\n" +
-                _tab(1) + "}\n")
+        lines = _copy_read(
+            f"{parent_member}{self.identifier}",
+            f"buf + {current_index}",
+            self.get_data_size(),
+            False)
+        return "".join(_tab() + line + "\n" for line in lines)
 
     def generate_write_code(self, current_index: int, parent_member: str) -> str:
-        return (_tab(1) + f"for (int i = 0; i < {self.get_data_size()}; i++) {{\n" +
-                _tab(2) +
-                f"*(buf + {current_index} + i) = {parent_member}{self.identifier}[i];\n" +
-                _tab(1) + "}\n")
+        return (_tab() +
+                f"memcpy(buf + {current_index}, {parent_member}{self.identifier}, {self.get_data_size()});\n")
+
+    def generate_view_getter_code(self, offset: str, view_type: str, params: str) -> str:
+        return _view_getter(
+            self.identifier,
+            "uint8_t *",
+            view_type,
+            params,
+            f"view->buf + {offset}")
+
+    def generate_column_member(self, loops: list) -> str:
+        return _column_member(self.identifier, "uint8_t", _loop_dims(loops) + f"[{self.get_data_size()}]")
+
+    def generate_column_read_code(self, offset: str, loops: list) -> str:
+        return _column_copy_read(self.identifier, loops, offset, self.get_data_size(), False)
+
+    def generate_safe_getter_code(self) -> Tuple[str, str]:
+        entry_count = len(self.entries)
+        if entry_count > 64:
+            return None
+        # Selected options as bits of one word, bits beyond the entries are cleared
+        signature = f"uint64_t get_{self.identifier}(uint8_t *{self.identifier})"
+        content = f"""{signature} {{
+{_tab()}return bitmap_to_uint64({self.identifier}, {self.get_data_size()}) & 0x{(1 << entry_count) - 1:X}ull;
+}}"""
+        return signature + ";", content
+
+    def generate_clamp_code(self, parent_member: str, depth: int) -> str:
+        if self.generate_safe_getter_code() is None:
+            return None
+        member = f"{parent_member}{self.identifier}"
+        return _tab(depth) + f"uint64_to_bitmap(get_{self.identifier}({member}), {member}, {self.get_data_size()});\n"
 
 class BoolProperty(Property):
     """Bool property.
@@ -406,6 +836,9 @@ class BoolProperty(Property):
     def serialize_data(self) -> list:
         return [self.default]
 
+    def _get_cpp_type(self) -> str:
+        return "bool"
+
     def generate_struct_member(self) -> str:
         return _tab(self.depth) + f"uint8_t {self.identifier};\n"
 
@@ -423,6 +856,20 @@ class BoolProperty(Property):
             type_conversion_method="bool_to_bytes",
             data_index=current_index)
 
+    def generate_view_getter_code(self, offset: str, view_type: str, params: str) -> str:
+        return _view_getter(
+            self.identifier,
+            "uint8_t",
+            view_type,
+            params,
+            f"bytes_to_bool(view->buf + {offset})")
+
+    def generate_column_member(self, loops: list) -> str:
+        return _column_member(self.identifier, "uint8_t", _loop_dims(loops))
+
+    def generate_column_read_code(self, offset: str, loops: list) -> str:
+        return _column_converter_read(self.identifier, loops, offset, "bytes_to_bool")
+
 class ArrayProperty(Property):
     """Array property.
     """
@@ -471,40 +918,326 @@ class ArrayProperty(Property):
         enums = [sub_prop.generate_enums() for sub_prop in self.sub_properties]
         return "\n".join(filter(lambda x: x is not None, enums))
 
+    def _get_bulk_member(self, parent_member: str) -> Tuple[str, str]:
+        # Member access of the single sub property in the first entry and the stride between entries
+        entry = f"{parent_member}{self.identifier}[0]"
+        return f"{entry}.{self.sub_properties[0].identifier}", f"sizeof({entry})"
+
     def generate_read_code(self, current_index: int, parent_member: str) -> str:
-        data_index = current_index
+        if len(self.sub_properties) == 1:
+            first_member, stride = self._get_bulk_member(parent_member)
+            bulk = self.sub_properties[0].generate_array_read_code(
+                current_index, first_member, self.max_entries, stride)
+            if bulk is not None:
+                return bulk
+        return self._generate_entries_code(
+            current_index,
+            parent_member,
+            lambda sub_prop, data_index, entry: sub_prop.generate_read_code(data_index, entry))
+
+    def generate_write_code(self, current_index: int, parent_member: str) -> str:
+        if len(self.sub_properties) == 1:
+            first_member, stride = self._get_bulk_member(parent_member)
+            bulk = self.sub_properties[0].generate_array_write_code(
+                current_index, first_member, self.max_entries, stride)
+            if bulk is not None:
+                return bulk
+        return self._generate_entries_code(
+            current_index,
+            parent_member,
+            lambda sub_prop, data_index, entry: sub_prop.generate_write_code(data_index, entry))
+
+    def _generate_entries_code(self, current_index, parent_member: str, generate) -> str:
+        # generate creates the code of a sub property from its index in the byte array and the entry prefix
+        if self.max_entries <= _setting("ARRAY_UNROLL_THRESHOLD"):
+            offset = 0
+            lines = []
+            for instance in range(0, self.max_entries):
+                for sub_prop in self.sub_properties:
+                    lines.append(generate(sub_prop, _add_offset(current_index, offset), f"{parent_member}{self.identifier}[{instance}]."))
+                    offset += sub_prop.get_data_size()
+            return "".join(filter(lambda x: x is not None, lines))
+        entry_size = sum(map(lambda s: s.get_data_size(), self.sub_properties))
+        index = f"{self.identifier}_index"
+        entry_index = f"{current_index} + {index} * {entry_size}"
+        sub_index = 0
         lines = []
-        for instance in range(0, self.max_entries):
-            for sub_prop in self.sub_properties:
-                member_read = sub_prop.generate_read_code(
-                    data_index,
-                    f"{parent_member}{self.identifier}[{instance}].")
-                data_index += sub_prop.get_data_size()
-                lines.append(member_read)
+        for sub_prop in self.sub_properties:
+            lines.append(generate(sub_prop, _add_offset(entry_index, sub_index), f"{parent_member}{self.identifier}[{index}]."))
+            sub_index += sub_prop.get_data_size()
+        lines = list(filter(lambda x: x is not None, lines))
+        if len(lines) == 0:
+            return None
+        return (_tab() + f"for (size_t {index} = 0; {index} < {self.max_entries}; {index}++) {{\n" +
+                "".join(map(_indent, lines)) +
+                _tab() + "}\n")
+
+    def generate_view_getter_code(self, offset: str, view_type: str, params: str) -> str:
+        entry_size = sum(map(lambda s: s.get_data_size(), self.sub_properties))
+        entry_params = params + f", size_t {self.identifier}_index"
+        sub_index = 0
+        getters = []
+        for sub_prop in self.sub_properties:
+            sub_offset = f"{offset} + {self.identifier}_index * {entry_size} + {sub_index}"
+            getters.append(sub_prop.generate_view_getter_code(sub_offset, view_type, entry_params))
+            sub_index += sub_prop.get_data_size()
+        getters = list(filter(lambda x: x is not None, getters))
+        if len(getters) > 0:
+            return "\n".join(getters)
+        return None
+
+    def generate_column_member(self, loops: list) -> str:
+        entry_loops = loops + [(f"{self.identifier}_index", self.max_entries)]
+        members = [sub_prop.generate_column_member(entry_loops) for sub_prop in self.sub_properties]
+        return "".join(filter(lambda x: x is not None, members))
+
+    def generate_column_read_code(self, offset: str, loops: list) -> str:
+        entry_size = sum(map(lambda s: s.get_data_size(), self.sub_properties))
+        index = f"{self.identifier}_index"
+        entry_loops = loops + [(index, self.max_entries)]
+        sub_index = 0
+        lines = []
+        for sub_prop in self.sub_properties:
+            sub_offset = f"{offset} + {index} * {entry_size} + {sub_index}"
+            lines.append(sub_prop.generate_column_read_code(sub_offset, entry_loops))
+            sub_index += sub_prop.get_data_size()
+        return "".join(filter(lambda x: x is not None, lines))
+
+    def generate_cpp_member(self) -> str:
+        members = [sub_prop.generate_cpp_member() for sub_prop in self.sub_properties]
+        return (_tab(self.depth) + "struct {\n" +
+                "".join(filter(lambda x: x is not None, members)) +
+                _tab(self.depth) + f"}} {self.identifier}[{self.max_entries}];\n")
+
+    def generate_cpp_field(self, offset: int) -> str:
+        entry_size = sum(map(lambda s: s.get_data_size(), self.sub_properties))
+        sub_index = 0
+        fields = []
+        for sub_prop in self.sub_properties:
+            fields.append(sub_prop.generate_cpp_field(sub_index))
+            sub_index += sub_prop.get_data_size()
+        return (_cpp_field(self, f"eput::array_field<{offset}, {entry_size}, {self.max_entries}>") +
+                _tab(self.depth) + f"namespace {self.identifier}_entry {{\n" +
+                "".join(filter(lambda x: x is not None, fields)) +
+                _tab(self.depth) + "}\n")
+
+    def _generate_cpp_loop(self, scope: str, payload: str, depth: int, statements) -> str:
+        # statements creates the loop body from scope, payload and depth of the entry
+        index = f"{self.identifier}_index"
+        entry = f"{self.identifier}_bytes"
+        lines = [
+            _tab(depth) + f"for (std::size_t {index} = 0; {index} < {scope}{self.identifier}::count; {index}++) {{\n",
+            _tab(depth + 1) + f"const auto {entry} = {scope}{self.identifier}::entry({payload}, {index});\n"]
+        lines.extend(statements(f"{scope}{self.identifier}_entry::", entry, index, depth + 1))
+        lines.append(_tab(depth) + "}\n")
         return "".join(filter(lambda x: x is not None, lines))
 
+    def generate_cpp_decode_code(self, scope: str, payload: str, target: str, depth: int) -> str:
+        return self._generate_cpp_loop(
+            scope,
+            payload,
+            depth,
+            lambda sub_scope, entry, index, sub_depth: [
+                sub_prop.generate_cpp_decode_code(sub_scope, entry, f"{target}{self.identifier}[{index}].", sub_depth)
+                for sub_prop in self.sub_properties])
+
+    def generate_cpp_encode_code(self, scope: str, payload: str, source: str, depth: int) -> str:
+        return self._generate_cpp_loop(
+            scope,
+            payload,
+            depth,
+            lambda sub_scope, entry, index, sub_depth: [
+                sub_prop.generate_cpp_encode_code(sub_scope, entry, f"{source}{self.identifier}[{index}].", sub_depth)
+                for sub_prop in self.sub_properties])
+
+    def generate_layout_entries(self, offset: int, parent: int, entries: list) -> None:
+        entry_size = sum(map(lambda s: s.get_data_size(), self.sub_properties))
+        index = len(entries)
+        entries.append(_layout_entry(self, offset, parent, size=entry_size, count=self.max_entries))
+        sub_index = 0
+        for sub_prop in self.sub_properties:
+            sub_prop.generate_layout_entries(sub_index, index, entries)
+            sub_index += sub_prop.get_data_size()
+
+    def generate_clamp_code(self, parent_member: str, depth: int) -> str:
+        index = f"{self.identifier}_index"
+        entry = f"{parent_member}{self.identifier}[{index}]."
+        members = [sub_prop.generate_clamp_code(entry, depth + 1) for sub_prop in self.sub_properties]
+        members = list(filter(lambda x: x is not None, members))
+        if len(members) == 0:
+            return None
+        return (_tab(depth) + f"for (size_t {index} = 0; {index} < {self.max_entries}; {index}++) {{\n" +
+                "".join(members) +
+                _tab(depth) + "}\n")
+
+    def generate_safe_getter_code(self) -> Tuple[str, str]:
+        return _join_safe_getters(self.sub_properties)
+
+    def generate_fixp_kernel_code(self) -> str:
+        kernels = [sub_prop.generate_fixp_kernel_code() for sub_prop in self.sub_properties]
+        kernels = list(filter(lambda x: x is not None, kernels))
+        if len(kernels) == 0:
+            return None
+        return "\n".join(kernels)
+
+class BitFieldProperty(Property):
+    """Bit field property, packs bools and one out of many selections into shared bytes.
+
+    Sub properties take consecutive bits in order, bools 1 bit and selections of M entries the bits needed for M.
+    Bit n is bit n % 8 of byte n / 8, like in the bitmaps of many out of many selections.
+    Members of sub properties are generated on the level of the bit field, like without packing.
+    """
+
+    category = "bit_field"
+
+    def __init__(self, yaml_prop: YAML, id_list: list, depth: int) -> None:
+        super().__init__(yaml_prop, id_list, depth)
+        self.code = 0b10100011
+        self.sub_properties = []
+        self.bit_offsets = []
+        self.bit_widths = []
+        bit_offset = 0
+        for sub_prop_yaml in self.property[PROPERTIES_KEY]:
+            prop_class = PROPERTY_TYPES[sub_prop_yaml[TYPE_KEY].data]
+            if prop_class not in [BoolProperty, OneOutOfMProperty]:
+                error(sub_prop_yaml, "Only bool and one_out_of_m properties allowed in bit fields")
+            sub_prop = prop_class(sub_prop_yaml, self.id_list, depth)
+            width = 1 if prop_class is BoolProperty else max(1, len(sub_prop.entries).bit_length())
+            self.sub_properties.append(sub_prop)
+            self.bit_offsets.append(bit_offset)
+            self.bit_widths.append(width)
+            bit_offset += width
+        if len(self.sub_properties) > 255:
+            error(self.property, "Must have less than 256 properties")
+        self.bit_count = bit_offset
+
+    def _get_fields(self):
+        # Sub property, byte index, shift in that byte, mask and whether the field continues in the next byte
+        for sub_prop, bit_offset, width in zip(self.sub_properties, self.bit_offsets, self.bit_widths):
+            shift = bit_offset % 8
+            yield sub_prop, bit_offset // 8, shift, (1 << width) - 1, shift + width > 8
+
+    @staticmethod
+    def _extract(byte: str, next_byte: str, shift: int, mask: int, straddles: bool) -> str:
+        word = f"({byte} | ({next_byte} << 8))" if straddles else byte
+        if shift > 0:
+            word = f"({word} >> {shift})"
+        return f"(uint8_t) ({word} & 0x{mask:X})"
+
+    @staticmethod
+    def _value(sub_prop, member: str, mask: int) -> str:
+        if isinstance(sub_prop, BoolProperty):
+            return f"({member} != 0)"
+        return f"({member} & 0x{mask:X})"
+
+    def get_data_size(self) -> int:
+        return math.ceil(self.bit_count / 8)
+
+    def serialize(self) -> list:
+        serialized = super().serialize()
+        serialized.append(len(self.sub_properties))
+        for sub_prop in self.sub_properties:
+            serialized.extend(sub_prop.serialize())
+        return serialized
+
+    def serialize_data(self) -> list:
+        packed = 0
+        for sub_prop, bit_offset in zip(self.sub_properties, self.bit_offsets):
+            packed |= sub_prop.default << bit_offset
+        return list(packed.to_bytes(self.get_data_size(), byteorder="little"))
+
+    def generate_struct_member(self) -> str:
+        return "".join(sub_prop.generate_struct_member() for sub_prop in self.sub_properties)
+
+    def generate_enums(self) -> str:
+        enums = [sub_prop.generate_enums() for sub_prop in self.sub_properties]
+        enums = list(filter(lambda x: x is not None, enums))
+        if len(enums) == 0:
+            return None
+        return "\n".join(enums)
+
+    def generate_read_code(self, current_index: int, parent_member: str) -> str:
+        lines = []
+        for sub_prop, byte, shift, mask, straddles in self._get_fields():
+            value = self._extract(
+                f"buf[{_add_offset(current_index, byte)}]",
+                f"buf[{_add_offset(current_index, byte + 1)}]",
+                shift,
+                mask,
+                straddles)
+            lines.append(_tab() + f"{parent_member}{sub_prop.identifier} = {value};\n")
+        return "".join(lines)
+
     def generate_write_code(self, current_index: int, parent_member: str) -> str:
-        data_index = current_index
+        lines = [_tab() + f"memset(buf + {current_index}, 0, {self.get_data_size()});\n"]
+        for sub_prop, byte, shift, mask, straddles in self._get_fields():
+            value = self._value(sub_prop, f"{parent_member}{sub_prop.identifier}", mask)
+            shifted = f"({value} << {shift})" if shift > 0 else value
+            lines.append(_tab() + f"buf[{_add_offset(current_index, byte)}] |= (uint8_t) {shifted};\n")
+            if straddles:
+                lines.append(_tab() + f"buf[{_add_offset(current_index, byte + 1)}] |= (uint8_t) ({value} >> {8 - shift});\n")
+        return "".join(lines)
+
+    def generate_view_getter_code(self, offset: str, view_type: str, params: str) -> str:
+        getters = []
+        for sub_prop, byte, shift, mask, straddles in self._get_fields():
+            getters.append(_view_getter(
+                sub_prop.identifier,
+                "uint8_t",
+                view_type,
+                params,
+                self._extract(
+                    f"view->buf[{_add_offset(offset, byte)}]",
+                    f"view->buf[{_add_offset(offset, byte + 1)}]",
+                    shift,
+                    mask,
+                    straddles)))
+        return "\n".join(getters)
+
+    def generate_column_member(self, loops: list) -> str:
+        return "".join(_column_member(sub_prop.identifier, "uint8_t", _loop_dims(loops)) for sub_prop in self.sub_properties)
+
+    def generate_column_read_code(self, offset: str, loops: list) -> str:
         lines = []
-        for instance in range(0, self.max_entries):
-            for sub_prop in self.sub_properties:
-                member_write = sub_prop.generate_write_code(
-                    data_index,
-                    f"{parent_member}{self.identifier}[{instance}].")
-                data_index += sub_prop.get_data_size()
-                lines.append(member_write)
-        return "".join(filter(lambda x: x is not None, lines))
+        for sub_prop, byte, shift, mask, straddles in self._get_fields():
+            source = f"payloads[i * DATA_PAYLOAD_LENGTH + {_add_offset(offset, byte)}]"
+            next_source = f"payloads[i * DATA_PAYLOAD_LENGTH + {_add_offset(offset, byte + 1)}]"
+            value = self._extract(source, next_source, shift, mask, straddles)
+            lines.append(_column_read(sub_prop.identifier, loops, lambda target, value=value: [f"{target} = {value};"]))
+        return "".join(lines)
+
+    def generate_cpp_member(self) -> str:
+        return "".join(sub_prop.generate_cpp_member() for sub_prop in self.sub_properties)
+
+    def generate_cpp_field(self, offset: int) -> str:
+        fields = [_cpp_field(self, f"eput::bit_field_bytes<{offset}, {self.get_data_size()}>")]
+        for sub_prop, bit_offset, width in zip(self.sub_properties, self.bit_offsets, self.bit_widths):
+            fields.append(_cpp_field(sub_prop, f"eput::bit_field<{offset}, {bit_offset}, {width}, {sub_prop._get_cpp_type()}>"))
+        return "".join(fields)
+
+    def generate_cpp_decode_code(self, scope: str, payload: str, target: str, depth: int) -> str:
+        return "".join(sub_prop.generate_cpp_decode_code(scope, payload, target, depth) for sub_prop in self.sub_properties)
+
+    def generate_cpp_encode_code(self, scope: str, payload: str, source: str, depth: int) -> str:
+        lines = [_tab(depth) + f"{scope}{self.identifier}::clear({payload});\n"]
+        lines.extend(sub_prop.generate_cpp_encode_code(scope, payload, source, depth) for sub_prop in self.sub_properties)
+        return "".join(lines)
+
+    def generate_layout_entries(self, offset: int, parent: int, entries: list) -> None:
+        index = len(entries)
+        entries.append(_layout_entry(self, offset, parent))
+        for sub_prop, bit_offset, width in zip(self.sub_properties, self.bit_offsets, self.bit_widths):
+            entries.append(_layout_entry(sub_prop, bit_offset, index, size=width, is_bits=True))
+
+    def generate_clamp_code(self, parent_member: str, depth: int) -> str:
+        members = [sub_prop.generate_clamp_code(parent_member, depth) for sub_prop in self.sub_properties]
+        members = list(filter(lambda x: x is not None, members))
+        if len(members) == 0:
+            return None
+        return "".join(members)
 
     def generate_safe_getter_code(self) -> Tuple[str, str]:
-        getters = [sub_prop.generate_safe_getter_code() for sub_prop in self.sub_properties]
-        getters = list(filter(lambda x: x is not None, getters))
-        if len(getters) > 0:
-            signatures = [getter[0] for getter in getters]
-            functions = [getter[1] for getter in getters]
-            signatures = "\n".join(signatures)
-            functions = "\n".join(functions)
-            return (signatures, functions)
-        return None
+        return _join_safe_getters(self.sub_properties)
 
 class BaseIntegerProperty(Property):
     """Base class for numeric properties.
@@ -593,6 +1326,16 @@ class BaseIntegerProperty(Property):
         arr.extend(self._val_to_bytes(self.default))
         return arr
 
+    def _get_cpp_type(self) -> str:
+        return _cpp_type_name(self.type_name)
+
+    def generate_cpp_field(self, offset: int) -> str:
+        cpp_type = self._get_cpp_type()
+        limits = None
+        if self.min_val is not None or self.max_val is not None or self.step_size is not None:
+            limits = _cpp_limits(cpp_type, self.min_val, self.max_val, self.step_size)
+        return _cpp_field(self, f"eput::field<{offset}, {cpp_type}>", limits)
+
     def generate_struct_member(self) -> str:
         return _tab(self.depth) + f"{self.type_name} {self.identifier};\n"
 
@@ -610,7 +1353,116 @@ class BaseIntegerProperty(Property):
             type_conversion_method=self.write_converter,
             data_index=current_index)
 
+    def generate_array_read_code(self, current_index: int, first_member: str, count: int, stride: str) -> str:
+        return _tab() + f"{self.read_converter}_array(buf + {current_index}, &{first_member}, {count}, {stride});\n"
+
+    def generate_array_write_code(self, current_index: int, first_member: str, count: int, stride: str) -> str:
+        converter = self.write_converter.replace("_to_bytes", "_array_to_bytes")
+        return _tab() + f"{converter}(&{first_member}, buf + {current_index}, {count}, {stride});\n"
+
+    def generate_view_getter_code(self, offset: str, view_type: str, params: str) -> str:
+        return _view_getter(
+            self.identifier,
+            self.type_name,
+            view_type,
+            params,
+            f"{self.read_converter}(view->buf + {offset})")
+
+    def generate_column_member(self, loops: list) -> str:
+        return _column_member(self.identifier, self.type_name, _loop_dims(loops))
+
+    def generate_column_read_code(self, offset: str, loops: list) -> str:
+        return _column_converter_read(self.identifier, loops, offset, self.read_converter)
+
+    def generate_layout_entries(self, offset: int, parent: int, entries: list) -> None:
+        entries.append(_layout_entry(
+            self,
+            offset,
+            parent,
+            min_val=self.min_val,
+            max_val=self.max_val,
+            step_size=self.step_size,
+            is_float=self.category == "float"))
+
+    def _generate_quantize_code(self, value: str, bound: int) -> Tuple[list, str]:
+        # Round towards zero to a multiple of step_size without division, value is at most bound in magnitude
+        name = self.identifier
+        bits = self.data_size * 8
+        if self._is_signed():
+            unsigned_type = "u" + self.type_name
+            lines = [
+                f"{unsigned_type} {name}_negative = ({unsigned_type}) -({value} < 0);",
+                f"{unsigned_type} {name}_magnitude = (({unsigned_type}) {value} ^ {name}_negative) - {name}_negative;"]
+            magnitude = f"{name}_magnitude"
+        else:
+            unsigned_type = self.type_name
+            lines = []
+            magnitude = value
+        if self.step_size & (self.step_size - 1) == 0:
+            mask = ((1 << bits) - 1) & ~(self.step_size - 1)
+            quantized = f"({magnitude} & {_c_uint_literal(mask)})"
+        else:
+            multiplier, shift = _reciprocal(self.step_size, bound)
+            if bound * multiplier <= 0xFFFFFFFF:
+                quantized = f"((((uint32_t) {magnitude} * {multiplier}u) >> {shift}) * {self.step_size}u)"
+            elif bound * multiplier <= 0xFFFFFFFFFFFFFFFF:
+                quantized = f"((((uint64_t) {magnitude} * {multiplier}ULL) >> {shift}) * {self.step_size}u)"
+            else:
+                quantized = f"(({magnitude} / {_c_uint_literal(self.step_size)}) * {_c_uint_literal(self.step_size)})"
+        if self._is_signed():
+            lines.append(f"{unsigned_type} {name}_quantized = ({unsigned_type}) {quantized};")
+            return lines, f"({self.type_name}) (({name}_quantized ^ {name}_negative) - {name}_negative)"
+        return lines, f"({self.type_name}) {quantized}"
+
+    def _generate_branchless_getter_code(self) -> Tuple[str, str]:
+        signature = SAFE_GETTER_TEMPLATE.format(
+            rtype=self.type_name,
+            name=self.identifier
+        )
+        name = self.identifier
+        bits = self.data_size * 8
+        if self._is_signed():
+            type_min, type_max = -(1 << (bits - 1)), (1 << (bits - 1)) - 1
+        else:
+            type_min, type_max = 0, (1 << bits) - 1
+        # Limits outside of the type range can't be exceeded and would only cause warnings
+        min_val = self.min_val if self.min_val is not None and self.min_val > type_min else None
+        max_val = self.max_val if self.max_val is not None and self.max_val < type_max else None
+        lines = []
+        value = name
+        selected = []
+        if min_val is not None:
+            lines.append(f"{self.type_name} {name}_below = ({self.type_name}) -({name} < {_c_int_literal(min_val)});")
+            selected.append((f"{name}_below", min_val))
+        if max_val is not None:
+            lines.append(f"{self.type_name} {name}_above = ({self.type_name}) -({name} > {_c_int_literal(max_val)});")
+            selected.append((f"{name}_above", max_val))
+        if len(selected) > 0:
+            outside = " | ".join(mask for mask, _ in selected)
+            if len(selected) > 1:
+                lines.append(f"{self.type_name} {name}_outside = {outside};")
+                outside = f"{name}_outside"
+            limits = "".join(f" | ({_c_int_literal(limit)} & {mask})" for mask, limit in selected)
+            lines.append(f"{self.type_name} {name}_clamped = ({self.type_name}) (({name} & ~{outside}){limits});")
+            value = f"{name}_clamped"
+        result = value
+        if self.step_size is not None and self.step_size > 1:
+            low = min_val if min_val is not None else type_min
+            high = max_val if max_val is not None else type_max
+            quantize_lines, quantized = self._generate_quantize_code(value, max(abs(low), abs(high)))
+            lines.extend(quantize_lines)
+            result = quantized
+            if len(selected) > 0:
+                # Limits are returned as they are, like the default getters do
+                lines.append(f"{self.type_name} {name}_step = {quantized};")
+                result = f"({self.type_name}) (({name}_step & ~{outside}) | ({value} & {outside}))"
+        lines.append(f"return {result};")
+        content = signature + " {\n" + "".join(_tab() + line + "\n" for line in lines) + "}"
+        return signature + ";", content
+
     def generate_safe_getter_code(self) -> Tuple[str, str]:
+        if _setting("BRANCHLESS_GETTERS") and self.category == "integer":
+            return self._generate_branchless_getter_code()
         signature = SAFE_GETTER_TEMPLATE.format(
             rtype=self.type_name,
             name=self.identifier
@@ -824,6 +1676,9 @@ class BaseNumberListProperty(Property):
         arr.extend(self._val_to_bytes(self.default))
         return arr
 
+    def _get_cpp_type(self) -> str:
+        return _cpp_type_name(self.type_name)
+
     def generate_struct_member(self) -> str:
         return _tab(self.depth) + f"{self.type_name} {self.identifier};\n"
 
@@ -841,6 +1696,20 @@ class BaseNumberListProperty(Property):
             type_conversion_method=self.write_converter,
             data_index=current_index)
 
+    def generate_view_getter_code(self, offset: str, view_type: str, params: str) -> str:
+        return _view_getter(
+            self.identifier,
+            self.type_name,
+            view_type,
+            params,
+            f"{self.read_converter}(view->buf + {offset})")
+
+    def generate_column_member(self, loops: list) -> str:
+        return _column_member(self.identifier, self.type_name, _loop_dims(loops))
+
+    def generate_column_read_code(self, offset: str, loops: list) -> str:
+        return _column_converter_read(self.identifier, loops, offset, self.read_converter)
+
     def generate_safe_getter_code(self) -> Tuple[str, str]:
         signature = SAFE_GETTER_TEMPLATE.format(
             rtype=self.type_name,
@@ -908,6 +1777,9 @@ class BaseDateProperty(Property):
             val = 0
         return list(val.to_bytes(length=8, byteorder="big", signed=True))
 
+    def _get_cpp_type(self) -> str:
+        return _cpp_type_name(self.type_name)
+
     def generate_struct_member(self) -> str:
         return _tab(self.depth) + f"{self.type_name} {self.identifier};\n"
 
@@ -925,6 +1797,20 @@ class BaseDateProperty(Property):
             type_conversion_method=self.write_converter,
             data_index=current_index)
 
+    def generate_view_getter_code(self, offset: str, view_type: str, params: str) -> str:
+        return _view_getter(
+            self.identifier,
+            self.type_name,
+            view_type,
+            params,
+            f"{self.read_converter}(view->buf + {offset})")
+
+    def generate_column_member(self, loops: list) -> str:
+        return _column_member(self.identifier, self.type_name, _loop_dims(loops))
+
+    def generate_column_read_code(self, offset: str, loops: list) -> str:
+        return _column_converter_read(self.identifier, loops, offset, self.read_converter)
+
 class DateProperty(BaseDateProperty):
     """Date property.
     """
@@ -1162,20 +2048,41 @@ class StringProperty(Property):
     def serialize_data(self) -> list:
         return self.default
 
+    def _get_cpp_type(self) -> str:
+        return f"std::array<std::uint8_t, {self.max_len}>"
+
+    def generate_cpp_field(self, offset: int) -> str:
+        return _cpp_field(self, f"eput::string_field<{offset}, {self.data_len}>")
+
     def generate_struct_member(self) -> str:
         return _tab(self.depth) + f"uint8_t {self.identifier}[{self.max_len}];\n"
 
     def generate_read_code(self, current_index: int, parent_member: str) -> str:
-        return (_tab(1) + f"for (int i = 0; i < {self.data_len}; i++) {{\n" +
-                _tab(2) +
-                f"{parent_member}{self.identifier}[i] = *(buf + {current_index} + i);\n" +
-                _tab(1) + "}\n")
+        # The payload holds max_len - 1 bytes, the struct buffer is always terminated
+        lines = _copy_read(
+            f"{parent_member}{self.identifier}",
+            f"buf + {current_index}",
+            self.data_len,
+            True)
+        return "".join(_tab() + line + "\n" for line in lines)
 
     def generate_write_code(self, current_index: int, parent_member: str) -> str:
-        return (_tab(1) + f"for (int i = 0; i < {self.data_len}; i++) {{\n" +
-                _tab(2) +
-                f"*(buf + {current_index} + i) = {parent_member}{self.identifier}[i];\n" +
-                _tab(1) + "}\n")
+        return (_tab() +
+                f"memcpy(buf + {current_index}, {parent_member}{self.identifier}, {self.data_len});\n")
+
+    def generate_view_getter_code(self, offset: str, view_type: str, params: str) -> str:
+        return _view_getter(
+            self.identifier,
+            "uint8_t *",
+            view_type,
+            params,
+            f"view->buf + {offset}")
+
+    def generate_column_member(self, loops: list) -> str:
+        return _column_member(self.identifier, "uint8_t", _loop_dims(loops) + f"[{self.max_len}]")
+
+    def generate_column_read_code(self, offset: str, loops: list) -> str:
+        return _column_copy_read(self.identifier, loops, offset, self.data_len, True)
 
 class AsciiStringProperty(StringProperty):
     """ASCII string property.
@@ -1314,6 +2221,17 @@ class BaseFixedPointProperty(Property):
     def serialize_data(self) -> list:
         return list(self._val_to_bytes(self.default))
 
+    def _get_cpp_type(self) -> str:
+        return _cpp_type_name(self.type_name)
+
+    def generate_cpp_field(self, offset: int) -> str:
+        unscaled_type = f"std::int{self.data_size * 8}_t"
+        limits = None
+        if self.min_val is not None or self.max_val is not None:
+            # Limits of unscaled value
+            limits = _cpp_limits(unscaled_type, self.min_val, self.max_val, None)
+        return _cpp_field(self, f"eput::fixed_point_field<{offset}, {unscaled_type}, {self.scale}>", limits)
+
     def generate_struct_member(self) -> str:
         return _tab(self.depth) + f"{self.type_name} {self.identifier};\n"
 
@@ -1323,26 +2241,113 @@ class BaseFixedPointProperty(Property):
     def generate_write_code(self, current_index: int, parent_member: str) -> str:
         return f"{_tab(1)}{self.write_converter}({parent_member}{self.identifier}, buf + {current_index});\n"
 
+    def generate_view_getter_code(self, offset: str, view_type: str, params: str) -> str:
+        return _view_getter(
+            self.identifier,
+            self.type_name,
+            view_type,
+            params,
+            f"{self.read_converter}(view->buf + {offset}, {self.scale})")
+
+    def generate_column_member(self, loops: list) -> str:
+        return _column_member(self.identifier, self.type_name, _loop_dims(loops))
+
+    def generate_column_read_code(self, offset: str, loops: list) -> str:
+        return _column_converter_read(
+            self.identifier,
+            loops,
+            offset,
+            self.read_converter,
+            f", {self.scale}")
+
+    def generate_layout_entries(self, offset: int, parent: int, entries: list) -> None:
+        entries.append(_layout_entry(
+            self,
+            offset,
+            parent,
+            min_val=self.min_val,
+            max_val=self.max_val,
+            scale=self.scale))
+
     def generate_safe_getter_code(self) -> Tuple[str, str]:
         signature = SAFE_GETTER_TEMPLATE.format(
             rtype=self.type_name,
             name=self.identifier
         )
         tab = _tab()
+        # Limits are compared to the unscaled value, the scale of the struct is kept
         content = signature + " {\n"
         if self.min_val is not None:
-            content += f"""{tab}if ({self.identifier} < {self.min_val}) {{
-{tab}{tab}return {self.min_val};
+            content += f"""{tab}if ({self.identifier}.unscaled < {self.min_val}) {{
+{tab}{tab}{self.identifier}.unscaled = {self.min_val};
 {tab}}}
 """
         if self.max_val is not None:
-            content += f"""{tab}if ({self.identifier} > {self.max_val}) {{
-{tab}{tab}return {self.max_val};
+            content += f"""{tab}if ({self.identifier}.unscaled > {self.max_val}) {{
+{tab}{tab}{self.identifier}.unscaled = {self.max_val};
 {tab}}}
 """
         content += f"{tab}return {self.identifier};\n}}"
         return signature + ";", content
 
+    def generate_fixp_kernel_code(self) -> str:
+        # Powers of 10 beyond 10^18 don't fit the 64 bit intermediate values
+        if abs(self.scale) > 18:
+            return None
+        tab = _tab()
+        name = self.identifier
+        fixp_type = self.type_name
+        factor = 10 ** abs(self.scale)
+        if self.data_size == 4:
+            unscaled_type = "int32_t"
+            sum_expression = "saturate_int32((int64_t) a.unscaled + b.unscaled)"
+            product = "(int64_t) a.unscaled * b.unscaled"
+            if self.scale > 0:
+                product_expression = f"saturate_int32(divide_round_int64({product}, {factor}))"
+                round_expression = f"(int32_t) divide_round_int64(val.unscaled, {factor})"
+            elif self.scale < 0:
+                product_expression = f"saturate_int32(saturate_multiply_int64({product}, {factor}))"
+                round_expression = f"saturate_int32(saturate_multiply_int64(val.unscaled, {factor}))"
+            else:
+                product_expression = f"saturate_int32({product})"
+                round_expression = "val.unscaled"
+        else:
+            unscaled_type = "int64_t"
+            sum_expression = "saturate_add_int64(a.unscaled, b.unscaled)"
+            product = "saturate_multiply_int64(a.unscaled, b.unscaled)"
+            if self.scale > 0:
+                product_expression = f"multiply_divide_int64(a.unscaled, b.unscaled, {factor}ll)"
+                round_expression = f"divide_round_int64(val.unscaled, {factor}ll)"
+            elif self.scale < 0:
+                product_expression = f"saturate_multiply_int64({product}, {factor}ll)"
+                round_expression = f"saturate_multiply_int64(val.unscaled, {factor}ll)"
+            else:
+                product_expression = product
+                round_expression = "val.unscaled"
+        return f"""// Fixed point arithmetic in the scale of {name}, operands have to be in scale {self.scale}
+static inline {fixp_type} rescale_{name}({fixp_type} val) {{
+{tab}return rescale_{fixp_type}(val, {self.scale});
+}}
+
+static inline {fixp_type} add_{name}({fixp_type} a, {fixp_type} b) {{
+{tab}a.unscaled = {sum_expression};
+{tab}return a;
+}}
+
+static inline {fixp_type} multiply_{name}({fixp_type} a, {fixp_type} b) {{
+{tab}a.unscaled = {product_expression};
+{tab}return a;
+}}
+
+static inline int compare_{name}({fixp_type} a, {fixp_type} b) {{
+{tab}return (a.unscaled > b.unscaled) - (a.unscaled < b.unscaled);
+}}
+
+static inline {unscaled_type} round_{name}({fixp_type} val) {{
+{tab}return {round_expression};
+}}
+"""
+
 class FixedPoint32Property(BaseFixedPointProperty):
     """32 bit fixed point property.
     """
@@ -1384,6 +2389,7 @@ PROPERTY_TYPES = {
     "n_out_of_m":         NOutOfMProperty,
     "bool":               BoolProperty,
     "array":              ArrayProperty,
+    "bit_field":          BitFieldProperty,
     "uint8_t":            UInt8Property,
     "uint16_t":           UInt16Property,
     "uint32_t":           UInt32Property,
@@ -1,6 +1,9 @@
 """Utility functions.
 """
+import functools
+import hashlib
 import sys
+from pathlib import Path
 from strictyaml import YAML
 
 def serialize_ascii(text: str) -> bytes:
@@ -56,6 +59,22 @@ def generate_device_id(config) -> bytes:
     data.extend(protocol_version.to_bytes(length=1, byteorder="big", signed=False))
     return bytes(data)
 
+@functools.lru_cache(maxsize=None)
+def generator_fingerprint() -> str:
+    """Hash the generator and utility code, changes to them invalidate everything cached from earlier versions.
+
+    Returns:
+        str: hex digest of all package files
+    """
+
+    package = Path(__file__).parent
+    digest = hashlib.sha256()
+    for pattern in ["*.py", "c/*", "cpp/*"]:
+        for path in sorted(package.glob(pattern)):
+            digest.update(path.name.encode("utf-8"))
+            digest.update(path.read_bytes())
+    return digest.hexdigest()
+
 def error(yaml_prop: YAML, message: str) -> None:
     print("Error in")
     print("-" * 20)
@@ -1,13 +1,16 @@
 """Provides functions for parsing YAML descriptor documents.
 """
 
+import hashlib
+import pickle
 import re
 import os
 from strictyaml import (load, Map, MapPattern, Seq, Str, Float, Int, HexInt, Bool, Optional,
                         Any, ScalarValidator, EmptyList, YAMLValidationError)
 from strictyaml.representation import YAML
 from .properties import PROPERTY_TYPES
-from .util import error
+from .blob_generator import serialize_properties
+from .util import error, generate_device_id, generator_fingerprint
 
 class Id(ScalarValidator):
     """Custom validator for descriptor IDs.
@@ -114,7 +117,8 @@ MODIFIER_SCHEMA = Map({
 ITEM_SELECTION_SCHEMA = Map({
     "type": Str(),
     "id": Id(),
-    "entries": Seq(Str()),
+    # Entries become enumerators with --enums and keys of translations
+    "entries": Seq(Id()),
     Optional("dependencies"): MapPattern(Id(), EmptyList() | Seq(Id())),
     Optional("default"): Str() | Seq(Str())
 })
@@ -188,6 +192,12 @@ ARRAY_SCHEMA = Map({
     "properties": Seq(Any())
 })
 
+BIT_FIELD_SCHEMA = Map({
+    "type": Str(),
+    "id": Id(),
+    "properties": Seq(Any())
+})
+
 NUMBER_LIST_SCHEMA = Map({
     "type": Str(),
     "id": Id(),
@@ -206,6 +216,8 @@ BASE_SCHEMA = Map({
     Optional("translation_data"): Seq(TRANSLATIONS_SCHEMA)
 })
 
+COMPILED_SUFFIX = ".pickle"
+
 SCHEMAS = {
     "modifier": MODIFIER_SCHEMA,
     "item_selection": ITEM_SELECTION_SCHEMA,
@@ -216,31 +228,93 @@ SCHEMAS = {
     "string": STRING_SCHEMA,
     "bool": BOOL_SCHEMA,
     "array": ARRAY_SCHEMA,
+    "bit_field": BIT_FIELD_SCHEMA,
     "number_list": NUMBER_LIST_SCHEMA,
     "language_selection": LANGUAGE_SELECTION_SCHEMA
 }
 
-def parse(path) -> YAML:
-    """Parse a text file containing a YAML descriptor document into an object and validate it.
+def read_descriptor(path) -> str:
+    """Read a YAML descriptor document and resolve its include directives.
 
     Args:
-        text (str): the string to parse from
+        path (str): the file to read from
 
     Returns:
-        YAML: the YAML object created from the document
+        str: the document text with included files inserted
     """
 
     with open(path, "r") as yaml_text:
         text = yaml_text.read()
     par_path = os.sep.join(path.split(os.sep)[0:-1])
     pattern = re.compile(r"^.*?(?P<ws>[\t ]*)#[\t ]*include[\t ]*\"(?P<file>[^<>\s]+)\"$", re.MULTILINE)
-    text = pattern.sub(lambda m: get_include(par_path, m.group("file"), len(m.group("ws"))), text)
-    parsed = load(text, BASE_SCHEMA)
+    return pattern.sub(lambda m: get_include(par_path, m.group("file"), len(m.group("ws"))), text)
+
+def parse(path) -> YAML:
+    """Parse a text file containing a YAML descriptor document into an object and validate it.
+
+    Args:
+        path (str): the file to parse from
+
+    Returns:
+        YAML: the YAML object created from the document
+    """
+
+    return _parse_text(read_descriptor(path))
+
+class CompiledDescriptor:
+    """Everything exports need from a descriptor, built once from its YAML document.
+
+    Instances can be pickled, property objects leave out their YAML representation and translations
+    are kept as plain data. The serialized properties are shared by all metadata generated from it.
+    """
+
+    def __init__(self, yaml_config: YAML) -> None:
+        """Args:
+            yaml_config (YAML): the validated YAML descriptor
+        """
+
+        self.device_info = get_device_info(yaml_config)
+        self.device_id = generate_device_id(yaml_config)
+        self.ids = get_ids(yaml_config)
+        self.properties = get_properties(yaml_config)
+        self.serialized_properties = serialize_properties(self.properties)
+        self.translations = None
+        if "translation_data" in yaml_config:
+            self.translations = [translation.data for translation in yaml_config["translation_data"]]
+
+def compile_descriptor(path, cache_path=None) -> CompiledDescriptor:
+    """Parse a YAML descriptor document into a compiled descriptor, optionally cached as pickle file.
+
+    Cache entries are named after the hash of the document including included files and the generator code,
+    so changed descriptors and generator updates are compiled again. Only use cache folders you trust,
+    loading a pickle file can execute arbitrary code.
+
+    Args:
+        path (str): the file to parse from
+        cache_path (str): folder to store compiled descriptors in, None to always parse
+
+    Returns:
+        CompiledDescriptor: the compiled descriptor
+    """
+
+    text = read_descriptor(path)
+    if cache_path is None:
+        return CompiledDescriptor(_parse_text(text))
+    key = hashlib.sha256((generator_fingerprint() + text).encode("utf-8")).hexdigest()
+    cache_file = os.path.join(cache_path, key + COMPILED_SUFFIX)
     try:
-        _validate_config(parsed)
-    except YAMLValidationError as ex:
-        error(None, ex)
-    return parsed
+        with open(cache_file, "rb") as file:
+            return pickle.load(file)
+    except (OSError, EOFError, pickle.UnpicklingError):
+        pass
+    compiled = CompiledDescriptor(_parse_text(text))
+    os.makedirs(cache_path, exist_ok=True)
+    # Write to a temporary file first, concurrent exports must not load partial entries
+    temp_file = f"{cache_file}.{os.getpid()}.tmp"
+    with open(temp_file, "wb") as file:
+        pickle.dump(compiled, file, protocol=pickle.HIGHEST_PROTOCOL)
+    os.replace(temp_file, cache_file)
+    return compiled
 
 def get_properties(yaml_config: YAML) -> list:
     """Create a list of property objects from YAML descriptor.
@@ -305,6 +379,14 @@ def get_ids(yaml) -> list:
         error(None, "Too many IDs (at most 65.536)")
     return ids
 
+def _parse_text(text) -> YAML:
+    parsed = load(text, BASE_SCHEMA)
+    try:
+        _validate_config(parsed)
+    except YAMLValidationError as ex:
+        error(None, ex)
+    return parsed
+
 def _validate_config(parsed_config, array=False) -> None:
     for prop in parsed_config["properties"]:
         type_name = prop["type"].data
@@ -313,7 +395,7 @@ def _validate_config(parsed_config, array=False) -> None:
         prop_type = PROPERTY_TYPES[type_name]
         schema = SCHEMAS[prop_type.category]
         prop.revalidate(schema)
-        if prop_type.category == "array":
+        if prop_type.category in ["array", "bit_field"]:
             _validate_config(prop, True)
 
 def _collect_ids(yaml, ids):
@@ -0,0 +1,346 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "fuzz_eput_utils.h"
+
+extern "C" {
+    #include "../src/eputgen/c/eput_utils.h"
+    #include "bench_lib.h"
+}
+
+// Number of values converted per iteration
+static const size_t VALUES = 256;
+
+template <typename T>
+void bench_decode(benchmark::State &state, T (*decode)(uint8_t *), size_t size) {
+    std::vector<uint8_t> buf(VALUES * size, 0x5A);
+    for (auto _ : state) {
+        for (size_t i = 0; i < VALUES; i++) {
+            T val = decode(buf.data() + i * size);
+            benchmark::DoNotOptimize(val);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * VALUES);
+    state.SetBytesProcessed(state.iterations() * VALUES * size);
+}
+
+template <typename T>
+void bench_decode_scaled(benchmark::State &state, T (*decode)(uint8_t *, int32_t), size_t size) {
+    std::vector<uint8_t> buf(VALUES * size, 0x5A);
+    for (auto _ : state) {
+        for (size_t i = 0; i < VALUES; i++) {
+            T val = decode(buf.data() + i * size, 3);
+            benchmark::DoNotOptimize(val);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * VALUES);
+    state.SetBytesProcessed(state.iterations() * VALUES * size);
+}
+
+template <typename T>
+void bench_encode(benchmark::State &state, void (*encode)(T, uint8_t *), size_t size) {
+    std::vector<uint8_t> buf(VALUES * size, 0);
+    T val = {};
+    for (auto _ : state) {
+        for (size_t i = 0; i < VALUES; i++) {
+            encode(val, buf.data() + i * size);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * VALUES);
+    state.SetBytesProcessed(state.iterations() * VALUES * size);
+}
+
+template <typename T>
+void bench_decode_array(benchmark::State &state, void (*decode)(uint8_t *, T *, size_t, size_t)) {
+    std::vector<uint8_t> buf(VALUES * sizeof(T), 0x5A);
+    std::vector<T> vals(VALUES);
+    for (auto _ : state) {
+        decode(buf.data(), vals.data(), VALUES, sizeof(T));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * VALUES);
+    state.SetBytesProcessed(state.iterations() * VALUES * sizeof(T));
+}
+
+template <typename T>
+void bench_encode_array(benchmark::State &state, void (*encode)(T *, uint8_t *, size_t, size_t)) {
+    std::vector<uint8_t> buf(VALUES * sizeof(T), 0);
+    std::vector<T> vals(VALUES);
+    for (auto _ : state) {
+        encode(vals.data(), buf.data(), VALUES, sizeof(T));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * VALUES);
+    state.SetBytesProcessed(state.iterations() * VALUES * sizeof(T));
+}
+
+BENCHMARK_CAPTURE(bench_decode, bytes_to_uint8, bytes_to_uint8, 1);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_uint16, bytes_to_uint16, 2);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_uint32, bytes_to_uint32, 4);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_uint64, bytes_to_uint64, 8);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_int8, bytes_to_int8, 1);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_int16, bytes_to_int16, 2);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_int32, bytes_to_int32, 4);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_int64, bytes_to_int64, 8);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_float, bytes_to_float, 4);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_double, bytes_to_double, 8);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_bool, bytes_to_bool, 1);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_time_point, bytes_to_time_point, 8);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_hh_mm_ss, bytes_to_hh_mm_ss, 3);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_date_range, bytes_to_date_range, 16);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_time_range, bytes_to_time_range, 6);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_zone_offset, bytes_to_zone_offset, 2);
+BENCHMARK_CAPTURE(bench_decode, bytes_to_zoned_time, bytes_to_zoned_time, 10);
+BENCHMARK_CAPTURE(bench_decode_scaled, bytes_to_fixp32, bytes_to_fixp32, 4);
+BENCHMARK_CAPTURE(bench_decode_scaled, bytes_to_fixp64, bytes_to_fixp64, 8);
+
+BENCHMARK_CAPTURE(bench_encode, uint8_to_bytes, uint8_to_bytes, 1);
+BENCHMARK_CAPTURE(bench_encode, uint16_to_bytes, uint16_to_bytes, 2);
+BENCHMARK_CAPTURE(bench_encode, uint32_to_bytes, uint32_to_bytes, 4);
+BENCHMARK_CAPTURE(bench_encode, uint64_to_bytes, uint64_to_bytes, 8);
+BENCHMARK_CAPTURE(bench_encode, int8_to_bytes, int8_to_bytes, 1);
+BENCHMARK_CAPTURE(bench_encode, int16_to_bytes, int16_to_bytes, 2);
+BENCHMARK_CAPTURE(bench_encode, int32_to_bytes, int32_to_bytes, 4);
+BENCHMARK_CAPTURE(bench_encode, int64_to_bytes, int64_to_bytes, 8);
+BENCHMARK_CAPTURE(bench_encode, float_to_bytes, float_to_bytes, 4);
+BENCHMARK_CAPTURE(bench_encode, double_to_bytes, double_to_bytes, 8);
+BENCHMARK_CAPTURE(bench_encode, bool_to_bytes, bool_to_bytes, 1);
+BENCHMARK_CAPTURE(bench_encode, time_point_to_bytes, time_point_to_bytes, 8);
+BENCHMARK_CAPTURE(bench_encode, hh_mm_ss_to_bytes, hh_mm_ss_to_bytes, 3);
+BENCHMARK_CAPTURE(bench_encode, date_range_to_bytes, date_range_to_bytes, 16);
+BENCHMARK_CAPTURE(bench_encode, time_range_to_bytes, time_range_to_bytes, 6);
+BENCHMARK_CAPTURE(bench_encode, zone_offset_to_bytes, zone_offset_to_bytes, 2);
+BENCHMARK_CAPTURE(bench_encode, zoned_time_to_bytes, zoned_time_to_bytes, 10);
+BENCHMARK_CAPTURE(bench_encode, fixp32_to_bytes, fixp32_to_bytes, 4);
+BENCHMARK_CAPTURE(bench_encode, fixp64_to_bytes, fixp64_to_bytes, 8);
+
+BENCHMARK_CAPTURE(bench_decode_array, bytes_to_uint16_array, bytes_to_uint16_array);
+BENCHMARK_CAPTURE(bench_decode_array, bytes_to_uint32_array, bytes_to_uint32_array);
+BENCHMARK_CAPTURE(bench_decode_array, bytes_to_uint64_array, bytes_to_uint64_array);
+BENCHMARK_CAPTURE(bench_decode_array, bytes_to_float_array, bytes_to_float_array);
+BENCHMARK_CAPTURE(bench_encode_array, uint16_array_to_bytes, uint16_array_to_bytes);
+BENCHMARK_CAPTURE(bench_encode_array, uint32_array_to_bytes, uint32_array_to_bytes);
+BENCHMARK_CAPTURE(bench_encode_array, uint64_array_to_bytes, uint64_array_to_bytes);
+BENCHMARK_CAPTURE(bench_encode_array, float_array_to_bytes, float_array_to_bytes);
+
+static std::vector<uint8_t> make_record(uint8_t flags, const std::string &type, size_t payload_length) {
+    std::vector<uint8_t> rec = {(uint8_t) (flags | TNF_URI), (uint8_t) type.size()};
+    if (payload_length < 256) {
+        rec[0] |= 0x10;
+        rec.push_back((uint8_t) payload_length);
+    } else {
+        for (int shift = 24; shift >= 0; shift -= 8) {
+            rec.push_back((uint8_t) (payload_length >> shift));
+        }
+    }
+    rec.insert(rec.end(), type.begin(), type.end());
+    rec.resize(rec.size() + payload_length, 0xA5);
+    return rec;
+}
+
+// NFC memory with `padding` NULL TLVs and a lock control TLV before the NDEF TLV
+static std::vector<uint8_t> make_memory(size_t padding, const std::vector<uint8_t> &message) {
+    std::vector<uint8_t> memory(padding, TLV_TYPE_NULL);
+    memory.insert(memory.end(), {0x01, 0x03, 0xA0, 0x0C, 0x34, TLV_TYPE_NDEF});
+    if (message.size() < 0xFF) {
+        memory.push_back((uint8_t) message.size());
+    } else {
+        memory.insert(memory.end(), {0xFF, (uint8_t) (message.size() >> 8), (uint8_t) message.size()});
+    }
+    memory.insert(memory.end(), message.begin(), message.end());
+    memory.push_back(TLV_TYPE_TERMINATOR);
+    return memory;
+}
+
+static std::vector<uint8_t> make_message(const uint8_t *payload, size_t payload_length, size_t meta_length) {
+    std::vector<uint8_t> message = make_record(0x80, RECORD_TYPE_SCHEME "/data", payload_length);
+    std::copy(payload, payload + payload_length, message.end() - payload_length);
+    std::vector<uint8_t> meta = make_record(0x40, RECORD_TYPE_SCHEME "/meta", meta_length);
+    message.insert(message.end(), meta.begin(), meta.end());
+    return message;
+}
+
+static void bench_get_ndef_tlv_offset(benchmark::State &state) {
+    std::vector<uint8_t> message = make_record(0xC0, RECORD_TYPE_SCHEME "/data", 64);
+    std::vector<uint8_t> memory = make_memory(state.range(0), message);
+    for (auto _ : state) {
+        size_t offset = 0;
+        uint16_t length = get_ndef_tlv_offset(memory.data(), memory.size(), &offset);
+        benchmark::DoNotOptimize(length);
+        benchmark::DoNotOptimize(offset);
+    }
+    state.SetBytesProcessed(state.iterations() * (state.range(0) + 6));
+}
+BENCHMARK(bench_get_ndef_tlv_offset)->Arg(0)->Arg(16)->Arg(64)->Arg(256)->Arg(1024)->Arg(4096);
+
+static void bench_get_record(benchmark::State &state) {
+    std::vector<uint8_t> rec = make_record(0xC0, RECORD_TYPE_SCHEME "/data", state.range(0));
+    for (auto _ : state) {
+        ndef_record record = {};
+        int ret = get_record(rec.data(), rec.size(), &record);
+        benchmark::DoNotOptimize(ret);
+        benchmark::DoNotOptimize(record);
+    }
+}
+BENCHMARK(bench_get_record)->Arg(32)->Arg(4096);
+
+static void bench_crc32(benchmark::State &state) {
+    std::vector<uint8_t> data(state.range(0), 0x5A);
+    uint8_t digest[CRC32_DIGEST_SIZE];
+    for (auto _ : state) {
+        crc32_ctx ctx;
+        crc32_init(&ctx);
+        crc32_update(&ctx, data.data(), data.size());
+        crc32_final(&ctx, digest);
+        benchmark::DoNotOptimize(digest);
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(bench_crc32)->Arg(64)->Arg(4096);
+
+static void bench_sha256(benchmark::State &state) {
+    std::vector<uint8_t> data(state.range(0), 0x5A);
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    for (auto _ : state) {
+        sha256_ctx ctx;
+        sha256_init(&ctx);
+        sha256_update(&ctx, data.data(), data.size());
+        sha256_final(&ctx, digest);
+        benchmark::DoNotOptimize(digest);
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(bench_sha256)->Arg(64)->Arg(4096);
+
+// Scheduler-like scan of a sparse 64 option bitmap, one call per option
+static void bench_is_option_selected(benchmark::State &state) {
+    uint8_t bitmap[8] = {0x01, 0x00, 0x10, 0x00, 0x00, 0x80, 0x00, 0x04};
+    for (auto _ : state) {
+        size_t sum = 0;
+        for (uint8_t option = 0; option < 64; option++) {
+            if (is_option_selected(bitmap, sizeof(bitmap), option)) {
+                sum += option;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(bench_is_option_selected);
+
+static void bench_find_next_selected_option(benchmark::State &state) {
+    uint8_t bitmap[8] = {0x01, 0x00, 0x10, 0x00, 0x00, 0x80, 0x00, 0x04};
+    for (auto _ : state) {
+        size_t sum = 0;
+        for (size_t option = find_next_selected_option(bitmap, sizeof(bitmap), 0);
+                option < sizeof(bitmap) * 8;
+                option = find_next_selected_option(bitmap, sizeof(bitmap), option + 1)) {
+            sum += option;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(bench_find_next_selected_option);
+
+static void bench_multiply_fixp32(benchmark::State &state) {
+    fixp32 factor = {1005, 3};
+    fixp32 val = {2150, 2};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(factor);
+        benchmark::DoNotOptimize(multiply_fixp32(val, factor));
+    }
+}
+BENCHMARK(bench_multiply_fixp32);
+
+static void bench_multiply_fixp64(benchmark::State &state) {
+    fixp64 factor = {1000000000000000005ll, 18};
+    fixp64 val = {123456789012345ll, 3};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(factor);
+        benchmark::DoNotOptimize(multiply_fixp64(val, factor));
+    }
+}
+BENCHMARK(bench_multiply_fixp64);
+
+static void bench_hash_bytes(benchmark::State &state) {
+    std::vector<uint8_t> data(state.range(0), 0x5A);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hash_bytes(data.data(), data.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(bench_hash_bytes)->Arg(64)->Arg(4096);
+
+// Parses the fuzzing seeds like the fuzzing harness, hardened length checks have to stay cheap
+static void bench_fuzz_corpus(benchmark::State &state) {
+    std::vector<std::vector<uint8_t>> corpus = load_fuzz_corpus("fuzz_corpus");
+    if (corpus.empty()) {
+        state.SkipWithError("fuzz_corpus not found, run from tests folder");
+        return;
+    }
+    size_t bytes = 0;
+    for (const std::vector<uint8_t> &input : corpus) {
+        bytes += input.size();
+    }
+    for (auto _ : state) {
+        for (std::vector<uint8_t> &input : corpus) {
+            benchmark::DoNotOptimize(parse_ndef_input(input.data(), input.size()));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * corpus.size());
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+BENCHMARK(bench_fuzz_corpus);
+
+static void bench_parse_nfc(benchmark::State &state, const bench_lib *lib) {
+    std::vector<uint8_t> payload(lib->payload_length, 0);
+    std::vector<uint8_t> config(lib->config_size, 0);
+    lib->generate_payload(payload.data(), config.data());
+    std::vector<uint8_t> memory = make_memory(16, make_message(payload.data(), payload.size(), state.range(0)));
+    if (lib->parse_nfc(memory.data(), memory.size(), config.data()) != SUCCESS) {
+        state.SkipWithError("parse_nfc failed");
+        return;
+    }
+    for (auto _ : state) {
+        int ret = lib->parse_nfc(memory.data(), memory.size(), config.data());
+        benchmark::DoNotOptimize(ret);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * lib->payload_length);
+}
+
+static void bench_parse_payload(benchmark::State &state, const bench_lib *lib) {
+    std::vector<uint8_t> payload(lib->payload_length, 0);
+    std::vector<uint8_t> config(lib->config_size, 0);
+    for (auto _ : state) {
+        int ret = lib->parse_payload(payload.data(), payload.size(), config.data());
+        benchmark::DoNotOptimize(ret);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * lib->payload_length);
+}
+
+static void bench_generate_payload(benchmark::State &state, const bench_lib *lib) {
+    std::vector<uint8_t> payload(lib->payload_length, 0);
+    std::vector<uint8_t> config(lib->config_size, 0);
+    for (auto _ : state) {
+        int ret = lib->generate_payload(payload.data(), config.data());
+        benchmark::DoNotOptimize(ret);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * lib->payload_length);
+}
+
+// Argument is the length of the meta data record following the data record
+BENCHMARK_CAPTURE(bench_parse_nfc, thermostat, &thermostat_bench)->Arg(64)->Arg(1024);
+BENCHMARK_CAPTURE(bench_parse_nfc, all_types, &all_types_bench)->Arg(64)->Arg(1024);
+BENCHMARK_CAPTURE(bench_parse_nfc, logger, &logger_bench)->Arg(64)->Arg(1024);
+BENCHMARK_CAPTURE(bench_parse_payload, thermostat, &thermostat_bench);
+BENCHMARK_CAPTURE(bench_parse_payload, all_types, &all_types_bench);
+BENCHMARK_CAPTURE(bench_parse_payload, logger, &logger_bench);
+BENCHMARK_CAPTURE(bench_generate_payload, thermostat, &thermostat_bench);
+BENCHMARK_CAPTURE(bench_generate_payload, all_types, &all_types_bench);
+BENCHMARK_CAPTURE(bench_generate_payload, logger, &logger_bench);
+
+BENCHMARK_MAIN();
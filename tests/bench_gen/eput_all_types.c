@@ -0,0 +1,135 @@
+#include <stdint.h>
+#include <string.h>
+#include "eput_all_types.h"
+
+int generate_payload(uint8_t *buf, all_types_config *config) {
+    EPUT_TRACE_BEGIN(EPUT_TRACE_GENERATE_PAYLOAD);
+    bool_to_bytes(config->enabled, buf + 0);
+    bool_to_bytes(config->eco, buf + 1);
+    uint8_to_bytes(config->mode, buf + 2);
+    memcpy(buf + 3, config->days, 2);
+    uint8_to_bytes(config->level, buf + 5);
+    uint16_to_bytes(config->setpoint, buf + 6);
+    int16_to_bytes(config->offset_val, buf + 8);
+    uint32_to_bytes(config->counter, buf + 10);
+    uint64_to_bytes(config->big, buf + 14);
+    int8_to_bytes(config->small, buf + 22);
+    int32_to_bytes(config->mid, buf + 23);
+    int64_to_bytes(config->huge, buf + 27);
+    float_to_bytes(config->ratio, buf + 35);
+    double_to_bytes(config->precise, buf + 39);
+    int64_to_bytes(config->choices, buf + 47);
+    double_to_bytes(config->dchoices, buf + 55);
+    time_point_to_bytes(config->day, buf + 63);
+    time_point_to_bytes(config->moment, buf + 71);
+    hh_mm_ss_to_bytes(config->alarm, buf + 79);
+    zoned_time_to_bytes(config->zoned, buf + 82);
+    date_range_to_bytes(config->holiday, buf + 92);
+    date_range_to_bytes(config->dtrange, buf + 108);
+    time_range_to_bytes(config->quiet, buf + 124);
+    memcpy(buf + 130, config->label, 15);
+    memcpy(buf + 145, config->note, 7);
+    memcpy(buf + 152, config->mail, 31);
+    fixp32_to_bytes(config->temp, buf + 183);
+    fixp64_to_bytes(config->energy, buf + 187);
+    uint8_to_bytes(config->lang, buf + 195);
+    for (size_t schedule_index = 0; schedule_index < 6; schedule_index++) {
+        hh_mm_ss_to_bytes(config->schedule[schedule_index].start, buf + 196 + schedule_index * 5);
+        uint8_to_bytes(config->schedule[schedule_index].temp_level, buf + 196 + schedule_index * 5 + 3);
+        bool_to_bytes(config->schedule[schedule_index].active, buf + 196 + schedule_index * 5 + 4);
+    }
+    uint16_array_to_bytes(&config->table[0].tval, buf + 226, 32, sizeof(config->table[0]));
+    memset(buf + 290, 0, 1);
+    buf[290] |= (uint8_t) (config->locked != 0);
+    buf[290] |= (uint8_t) ((config->fan & 0x7) << 1);
+    time_point_to_bytes(config->data_last_written_timestamp, buf + 291);
+    EPUT_TRACE_END(EPUT_TRACE_GENERATE_PAYLOAD, 299);
+    return SUCCESS;
+}
+
+int parse_payload(uint8_t *buf, size_t buf_len, all_types_config *config) {
+    if (buf_len != 299) {
+        return ERR_DATA_BUF_WRONG_LENGTH;
+    }
+    EPUT_TRACE_BEGIN(EPUT_TRACE_PARSE_PAYLOAD);
+    config->enabled = bytes_to_bool(buf + 0);
+    config->eco = bytes_to_bool(buf + 1);
+    config->mode = bytes_to_uint8(buf + 2);
+    memcpy(config->days, buf + 3, 2);
+    config->level = bytes_to_uint8(buf + 5);
+    config->setpoint = bytes_to_uint16(buf + 6);
+    config->offset_val = bytes_to_int16(buf + 8);
+    config->counter = bytes_to_uint32(buf + 10);
+    config->big = bytes_to_uint64(buf + 14);
+    config->small = bytes_to_int8(buf + 22);
+    config->mid = bytes_to_int32(buf + 23);
+    config->huge = bytes_to_int64(buf + 27);
+    config->ratio = bytes_to_float(buf + 35);
+    config->precise = bytes_to_double(buf + 39);
+    config->choices = bytes_to_int64(buf + 47);
+    config->dchoices = bytes_to_double(buf + 55);
+    config->day = bytes_to_time_point(buf + 63);
+    config->moment = bytes_to_time_point(buf + 71);
+    config->alarm = bytes_to_hh_mm_ss(buf + 79);
+    config->zoned = bytes_to_zoned_time(buf + 82);
+    config->holiday = bytes_to_date_range(buf + 92);
+    config->dtrange = bytes_to_date_range(buf + 108);
+    config->quiet = bytes_to_time_range(buf + 124);
+    memcpy(config->label, buf + 130, 15);
+    config->label[15] = 0;
+    memcpy(config->note, buf + 145, 7);
+    config->note[7] = 0;
+    memcpy(config->mail, buf + 152, 31);
+    config->mail[31] = 0;
+    config->temp = bytes_to_fixp32(buf + 183, 2);
+    config->energy = bytes_to_fixp64(buf + 187, 3);
+    config->lang = bytes_to_uint8(buf + 195);
+    for (size_t schedule_index = 0; schedule_index < 6; schedule_index++) {
+        config->schedule[schedule_index].start = bytes_to_hh_mm_ss(buf + 196 + schedule_index * 5);
+        config->schedule[schedule_index].temp_level = bytes_to_uint8(buf + 196 + schedule_index * 5 + 3);
+        config->schedule[schedule_index].active = bytes_to_bool(buf + 196 + schedule_index * 5 + 4);
+    }
+    bytes_to_uint16_array(buf + 226, &config->table[0].tval, 32, sizeof(config->table[0]));
+    config->locked = (uint8_t) (buf[290] & 0x1);
+    config->fan = (uint8_t) ((buf[290] >> 1) & 0x7);
+    config->data_last_written_timestamp = bytes_to_time_point(buf + 291);
+    EPUT_TRACE_END(EPUT_TRACE_PARSE_PAYLOAD, 299);
+    return SUCCESS;
+}
+
+int parse_nfc(uint8_t *buf, size_t buf_len, all_types_config *config) {
+    size_t ndef_offset = 0;
+    uint16_t ndef_length = get_ndef_tlv_offset(buf, buf_len, &ndef_offset);
+    if (ndef_length == 0 || (ndef_offset + ndef_length) > buf_len) {
+        return ERR_NO_NDEF_TLV;
+    } else {
+        ndef_record data = {0};
+        int parse_ret = get_data_record(
+            buf + ndef_offset,
+            ndef_length,
+            &data);
+        if (parse_ret > 0) {
+            return parse_payload(
+                data.payload,
+                data.payload_length,
+                config);
+        } else {
+            return parse_ret;
+        }
+    }
+}
+
+int parse_ndef(uint8_t *buf, size_t buf_len, all_types_config *config) {
+    ndef_record data = {0};
+    int record_result = get_data_record(buf, buf_len, &data);
+    if (record_result > 0) {
+        return parse_payload(
+            data.payload,
+            data.payload_length,
+            config);
+    } else {
+        return record_result;
+    }
+}
+
+
@@ -0,0 +1,151 @@
+#ifndef all_types
+#define all_types
+
+#include <stddef.h>
+#include "eput_utils.h"
+
+typedef struct {
+    uint8_t enabled;
+    uint8_t eco;
+    uint8_t mode;
+    uint8_t days[2];
+    uint8_t level;
+    uint16_t setpoint;
+    int16_t offset_val;
+    uint32_t counter;
+    uint64_t big;
+    int8_t small;
+    int32_t mid;
+    int64_t huge;
+    float ratio;
+    double precise;
+    int64_t choices;
+    double dchoices;
+    time_point day;
+    time_point moment;
+    hh_mm_ss alarm;
+    zoned_time zoned;
+    date_range holiday;
+    date_range dtrange;
+    time_range quiet;
+    uint8_t label[16];
+    uint8_t note[8];
+    uint8_t mail[32];
+    fixp32 temp;
+    fixp64 energy;
+    uint8_t lang;
+    struct {
+        hh_mm_ss start;
+        uint8_t temp_level;
+        uint8_t active;
+    } schedule[6];
+    struct {
+        uint16_t tval;
+    } table[32];
+    uint8_t locked;
+    uint8_t fan;
+    time_point data_last_written_timestamp;
+} all_types_config;
+
+
+#define DATA_PAYLOAD_LENGTH 299
+
+/**
+ * @brief Create the payload of a data record from a data struct.
+ *
+ * Assumes `buf` is at least `DATA_PAYLOAD_LENGTH` long.
+ * 
+ * @param buf Buffer to write data to
+ * @param config Pointer to the configuration struct
+ *
+ * @return status code
+ */
+int generate_payload(uint8_t *buf, all_types_config *config);
+
+/**
+ * @brief Parse the payload of a data record into a struct according to the configuration definition.
+ * 
+ * @param buf Buffer containing the payload from NDEF record
+ * @param buf_len Size of payload
+ * @param config pointer to an instance of the configuration struct
+ *
+ * @return status code
+ */
+int parse_payload(uint8_t *buf, size_t buf_len, all_types_config *config);
+
+/**
+ * @brief Parse the contents of NFC memory into a struct according to the configuration definition.
+ * 
+ * Only the data record is read and validated, the meta data record is skipped.
+ * 
+ * @param buf Buffer containing the data from NFC memory
+ * @param buf_len Size of `buf`
+ * @param config pointer to an instance of the configuration struct
+ *
+ * @return status code
+ */
+int parse_nfc(uint8_t *buf, size_t buf_len, all_types_config *config);
+
+/**
+ * @brief Parse an NDEF message into a struct according to the configuration definition.
+ * 
+ * Only the data record is read and validated, the meta data record is skipped.
+ * 
+ * @param buf Buffer containing the NDEF message
+ * @param buf_len Size of buffer
+ * @param config pointer to an instance of the configuration struct
+ *
+ * @return status code
+ */
+int parse_ndef(uint8_t *buf, size_t buf_len, all_types_config *config);
+
+
+
+// Fixed point arithmetic in the scale of temp, operands have to be in scale 2
+static inline fixp32 rescale_temp(fixp32 val) {
+    return rescale_fixp32(val, 2);
+}
+
+static inline fixp32 add_temp(fixp32 a, fixp32 b) {
+    a.unscaled = saturate_int32((int64_t) a.unscaled + b.unscaled);
+    return a;
+}
+
+static inline fixp32 multiply_temp(fixp32 a, fixp32 b) {
+    a.unscaled = saturate_int32(divide_round_int64((int64_t) a.unscaled * b.unscaled, 100));
+    return a;
+}
+
+static inline int compare_temp(fixp32 a, fixp32 b) {
+    return (a.unscaled > b.unscaled) - (a.unscaled < b.unscaled);
+}
+
+static inline int32_t round_temp(fixp32 val) {
+    return (int32_t) divide_round_int64(val.unscaled, 100);
+}
+
+// Fixed point arithmetic in the scale of energy, operands have to be in scale 3
+static inline fixp64 rescale_energy(fixp64 val) {
+    return rescale_fixp64(val, 3);
+}
+
+static inline fixp64 add_energy(fixp64 a, fixp64 b) {
+    a.unscaled = saturate_add_int64(a.unscaled, b.unscaled);
+    return a;
+}
+
+static inline fixp64 multiply_energy(fixp64 a, fixp64 b) {
+    a.unscaled = multiply_divide_int64(a.unscaled, b.unscaled, 1000ll);
+    return a;
+}
+
+static inline int compare_energy(fixp64 a, fixp64 b) {
+    return (a.unscaled > b.unscaled) - (a.unscaled < b.unscaled);
+}
+
+static inline int64_t round_energy(fixp64 val) {
+    return divide_round_int64(val.unscaled, 1000ll);
+}
+
+#endif
+
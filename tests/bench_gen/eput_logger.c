@@ -0,0 +1,80 @@
+#include <stdint.h>
+#include <string.h>
+#include "eput_logger.h"
+
+int generate_payload(uint8_t *buf, logger_config *config) {
+    EPUT_TRACE_BEGIN(EPUT_TRACE_GENERATE_PAYLOAD);
+    memcpy(buf + 0, config->location, 31);
+    uint32_to_bytes(config->interval, buf + 31);
+    for (size_t samples_index = 0; samples_index < 64; samples_index++) {
+        time_point_to_bytes(config->samples[samples_index].sample_time, buf + 35 + samples_index * 14);
+        float_to_bytes(config->samples[samples_index].sample_value, buf + 35 + samples_index * 14 + 8);
+        uint16_to_bytes(config->samples[samples_index].sample_flags, buf + 35 + samples_index * 14 + 12);
+    }
+    for (size_t alarms_index = 0; alarms_index < 16; alarms_index++) {
+        memcpy(buf + 931 + alarms_index * 7, config->alarms[alarms_index].alarm_days, 1);
+        time_range_to_bytes(config->alarms[alarms_index].alarm_window, buf + 931 + alarms_index * 7 + 1);
+    }
+    time_point_to_bytes(config->data_last_written_timestamp, buf + 1043);
+    EPUT_TRACE_END(EPUT_TRACE_GENERATE_PAYLOAD, 1051);
+    return SUCCESS;
+}
+
+int parse_payload(uint8_t *buf, size_t buf_len, logger_config *config) {
+    if (buf_len != 1051) {
+        return ERR_DATA_BUF_WRONG_LENGTH;
+    }
+    EPUT_TRACE_BEGIN(EPUT_TRACE_PARSE_PAYLOAD);
+    memcpy(config->location, buf + 0, 31);
+    config->location[31] = 0;
+    config->interval = bytes_to_uint32(buf + 31);
+    for (size_t samples_index = 0; samples_index < 64; samples_index++) {
+        config->samples[samples_index].sample_time = bytes_to_time_point(buf + 35 + samples_index * 14);
+        config->samples[samples_index].sample_value = bytes_to_float(buf + 35 + samples_index * 14 + 8);
+        config->samples[samples_index].sample_flags = bytes_to_uint16(buf + 35 + samples_index * 14 + 12);
+    }
+    for (size_t alarms_index = 0; alarms_index < 16; alarms_index++) {
+        memcpy(config->alarms[alarms_index].alarm_days, buf + 931 + alarms_index * 7, 1);
+        config->alarms[alarms_index].alarm_window = bytes_to_time_range(buf + 931 + alarms_index * 7 + 1);
+    }
+    config->data_last_written_timestamp = bytes_to_time_point(buf + 1043);
+    EPUT_TRACE_END(EPUT_TRACE_PARSE_PAYLOAD, 1051);
+    return SUCCESS;
+}
+
+int parse_nfc(uint8_t *buf, size_t buf_len, logger_config *config) {
+    size_t ndef_offset = 0;
+    uint16_t ndef_length = get_ndef_tlv_offset(buf, buf_len, &ndef_offset);
+    if (ndef_length == 0 || (ndef_offset + ndef_length) > buf_len) {
+        return ERR_NO_NDEF_TLV;
+    } else {
+        ndef_record data = {0};
+        int parse_ret = get_data_record(
+            buf + ndef_offset,
+            ndef_length,
+            &data);
+        if (parse_ret > 0) {
+            return parse_payload(
+                data.payload,
+                data.payload_length,
+                config);
+        } else {
+            return parse_ret;
+        }
+    }
+}
+
+int parse_ndef(uint8_t *buf, size_t buf_len, logger_config *config) {
+    ndef_record data = {0};
+    int record_result = get_data_record(buf, buf_len, &data);
+    if (record_result > 0) {
+        return parse_payload(
+            data.payload,
+            data.payload_length,
+            config);
+    } else {
+        return record_result;
+    }
+}
+
+
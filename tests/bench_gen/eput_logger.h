@@ -0,0 +1,77 @@
+#ifndef logger
+#define logger
+
+#include <stddef.h>
+#include "eput_utils.h"
+
+typedef struct {
+    uint8_t location[32];
+    uint32_t interval;
+    struct {
+        time_point sample_time;
+        float sample_value;
+        uint16_t sample_flags;
+    } samples[64];
+    struct {
+        uint8_t alarm_days[1];
+        time_range alarm_window;
+    } alarms[16];
+    time_point data_last_written_timestamp;
+} logger_config;
+
+
+#define DATA_PAYLOAD_LENGTH 1051
+
+/**
+ * @brief Create the payload of a data record from a data struct.
+ *
+ * Assumes `buf` is at least `DATA_PAYLOAD_LENGTH` long.
+ * 
+ * @param buf Buffer to write data to
+ * @param config Pointer to the configuration struct
+ *
+ * @return status code
+ */
+int generate_payload(uint8_t *buf, logger_config *config);
+
+/**
+ * @brief Parse the payload of a data record into a struct according to the configuration definition.
+ * 
+ * @param buf Buffer containing the payload from NDEF record
+ * @param buf_len Size of payload
+ * @param config pointer to an instance of the configuration struct
+ *
+ * @return status code
+ */
+int parse_payload(uint8_t *buf, size_t buf_len, logger_config *config);
+
+/**
+ * @brief Parse the contents of NFC memory into a struct according to the configuration definition.
+ * 
+ * Only the data record is read and validated, the meta data record is skipped.
+ * 
+ * @param buf Buffer containing the data from NFC memory
+ * @param buf_len Size of `buf`
+ * @param config pointer to an instance of the configuration struct
+ *
+ * @return status code
+ */
+int parse_nfc(uint8_t *buf, size_t buf_len, logger_config *config);
+
+/**
+ * @brief Parse an NDEF message into a struct according to the configuration definition.
+ * 
+ * Only the data record is read and validated, the meta data record is skipped.
+ * 
+ * @param buf Buffer containing the NDEF message
+ * @param buf_len Size of buffer
+ * @param config pointer to an instance of the configuration struct
+ *
+ * @return status code
+ */
+int parse_ndef(uint8_t *buf, size_t buf_len, logger_config *config);
+
+
+
+#endif
+
@@ -0,0 +1,69 @@
+#include <stdint.h>
+#include <string.h>
+#include "eput_thermostat.h"
+
+int generate_payload(uint8_t *buf, thermostat_config *config) {
+    EPUT_TRACE_BEGIN(EPUT_TRACE_GENERATE_PAYLOAD);
+    bool_to_bytes(config->enabled, buf + 0);
+    uint8_to_bytes(config->mode, buf + 1);
+    uint16_to_bytes(config->setpoint, buf + 2);
+    int16_to_bytes(config->calibration, buf + 4);
+    hh_mm_ss_to_bytes(config->night_start, buf + 6);
+    fixp32_to_bytes(config->hysteresis, buf + 9);
+    time_point_to_bytes(config->data_last_written_timestamp, buf + 13);
+    EPUT_TRACE_END(EPUT_TRACE_GENERATE_PAYLOAD, 21);
+    return SUCCESS;
+}
+
+int parse_payload(uint8_t *buf, size_t buf_len, thermostat_config *config) {
+    if (buf_len != 21) {
+        return ERR_DATA_BUF_WRONG_LENGTH;
+    }
+    EPUT_TRACE_BEGIN(EPUT_TRACE_PARSE_PAYLOAD);
+    config->enabled = bytes_to_bool(buf + 0);
+    config->mode = bytes_to_uint8(buf + 1);
+    config->setpoint = bytes_to_uint16(buf + 2);
+    config->calibration = bytes_to_int16(buf + 4);
+    config->night_start = bytes_to_hh_mm_ss(buf + 6);
+    config->hysteresis = bytes_to_fixp32(buf + 9, 1);
+    config->data_last_written_timestamp = bytes_to_time_point(buf + 13);
+    EPUT_TRACE_END(EPUT_TRACE_PARSE_PAYLOAD, 21);
+    return SUCCESS;
+}
+
+int parse_nfc(uint8_t *buf, size_t buf_len, thermostat_config *config) {
+    size_t ndef_offset = 0;
+    uint16_t ndef_length = get_ndef_tlv_offset(buf, buf_len, &ndef_offset);
+    if (ndef_length == 0 || (ndef_offset + ndef_length) > buf_len) {
+        return ERR_NO_NDEF_TLV;
+    } else {
+        ndef_record data = {0};
+        int parse_ret = get_data_record(
+            buf + ndef_offset,
+            ndef_length,
+            &data);
+        if (parse_ret > 0) {
+            return parse_payload(
+                data.payload,
+                data.payload_length,
+                config);
+        } else {
+            return parse_ret;
+        }
+    }
+}
+
+int parse_ndef(uint8_t *buf, size_t buf_len, thermostat_config *config) {
+    ndef_record data = {0};
+    int record_result = get_data_record(buf, buf_len, &data);
+    if (record_result > 0) {
+        return parse_payload(
+            data.payload,
+            data.payload_length,
+            config);
+    } else {
+        return record_result;
+    }
+}
+
+
@@ -0,0 +1,72 @@
+#ifndef thermostat
+#define thermostat
+
+#include <stddef.h>
+#include "eput_utils.h"
+
+typedef struct {
+    uint8_t enabled;
+    uint8_t mode;
+    uint16_t setpoint;
+    int16_t calibration;
+    hh_mm_ss night_start;
+    fixp32 hysteresis;
+    time_point data_last_written_timestamp;
+} thermostat_config;
+
+
+#define DATA_PAYLOAD_LENGTH 21
+
+/**
+ * @brief Create the payload of a data record from a data struct.
+ *
+ * Assumes `buf` is at least `DATA_PAYLOAD_LENGTH` long.
+ * 
+ * @param buf Buffer to write data to
+ * @param config Pointer to the configuration struct
+ *
+ * @return status code
+ */
+int generate_payload(uint8_t *buf, thermostat_config *config);
+
+/**
+ * @brief Parse the payload of a data record into a struct according to the configuration definition.
+ * 
+ * @param buf Buffer containing the payload from NDEF record
+ * @param buf_len Size of payload
+ * @param config pointer to an instance of the configuration struct
+ *
+ * @return status code
+ */
+int parse_payload(uint8_t *buf, size_t buf_len, thermostat_config *config);
+
+/**
+ * @brief Parse the contents of NFC memory into a struct according to the configuration definition.
+ * 
+ * Only the data record is read and validated, the meta data record is skipped.
+ * 
+ * @param buf Buffer containing the data from NFC memory
+ * @param buf_len Size of `buf`
+ * @param config pointer to an instance of the configuration struct
+ *
+ * @return status code
+ */
+int parse_nfc(uint8_t *buf, size_t buf_len, thermostat_config *config);
+
+/**
+ * @brief Parse an NDEF message into a struct according to the configuration definition.
+ * 
+ * Only the data record is read and validated, the meta data record is skipped.
+ * 
+ * @param buf Buffer containing the NDEF message
+ * @param buf_len Size of buffer
+ * @param config pointer to an instance of the configuration struct
+ *
+ * @return status code
+ */
+int parse_ndef(uint8_t *buf, size_t buf_len, thermostat_config *config);
+
+
+
+#endif
+
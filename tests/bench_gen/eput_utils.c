@@ -0,0 +1,2027 @@
+#include "eput_utils.h"
+#include <string.h>
+#include <limits.h>
+#include <stdalign.h>
+#include <assert.h>
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#if defined(__ARM_FEATURE_CRC32) || defined(__ARM_FEATURE_SHA2)
+#include <arm_acle.h>
+#endif
+
+#ifdef EPUT_TRACE
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+#define EPUT_TRACE_DWT
+#elif (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <x86intrin.h>
+#define EPUT_TRACE_TSC
+#else
+#include <time.h>
+#endif
+#endif
+
+#if !defined(EPUT_PORTABLE_CONVERSION) && defined(__GNUC__) && defined(__BYTE_ORDER__) \
+    && (!defined(__FLOAT_WORD_ORDER__) || __FLOAT_WORD_ORDER__ == __BYTE_ORDER__)
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define EPUT_NATIVE_CONVERSION
+#define EPUT_NATIVE_SWAP
+#define TO_BIG_ENDIAN_16(x) __builtin_bswap16(x)
+#define TO_BIG_ENDIAN_32(x) __builtin_bswap32(x)
+#define TO_BIG_ENDIAN_64(x) __builtin_bswap64(x)
+#define TO_LITTLE_ENDIAN_64(x) (x)
+#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define EPUT_NATIVE_CONVERSION
+#define TO_BIG_ENDIAN_16(x) (x)
+#define TO_BIG_ENDIAN_32(x) (x)
+#define TO_BIG_ENDIAN_64(x) (x)
+#define TO_LITTLE_ENDIAN_64(x) __builtin_bswap64(x)
+#endif
+#elif !defined(EPUT_PORTABLE_CONVERSION) && defined(_MSC_VER)
+// All targets supported by MSVC are little endian
+#include <stdlib.h>
+#define EPUT_NATIVE_CONVERSION
+#define EPUT_NATIVE_SWAP
+#define TO_BIG_ENDIAN_16(x) _byteswap_ushort(x)
+#define TO_BIG_ENDIAN_32(x) _byteswap_ulong(x)
+#define TO_BIG_ENDIAN_64(x) _byteswap_uint64(x)
+#define TO_LITTLE_ENDIAN_64(x) (x)
+#endif
+
+uint8_t bytes_to_uint8(uint8_t *bytes) {
+    return (uint8_t) bytes[0];
+}
+
+void uint8_to_bytes(uint8_t val, uint8_t *bytes) {
+    bytes[0] = (uint8_t) val;
+}
+
+int8_t bytes_to_int8(uint8_t *bytes) {
+    return (int8_t) *bytes;
+}
+
+void int8_to_bytes(int8_t val, uint8_t *bytes) {
+    bytes[0] = (uint8_t) val;
+}
+
+#ifdef EPUT_NATIVE_CONVERSION
+
+// Endianness is known at compile time, load whole words and swap bytes if necessary.
+// memcpy avoids unaligned access and is reduced to a single load or store by the compiler.
+
+uint16_t bytes_to_uint16(uint8_t *bytes) {
+    uint16_t val = 0;
+    memcpy(&val, bytes, sizeof(val));
+    return TO_BIG_ENDIAN_16(val);
+}
+
+uint32_t bytes_to_uint32(uint8_t *bytes) {
+    uint32_t val = 0;
+    memcpy(&val, bytes, sizeof(val));
+    return TO_BIG_ENDIAN_32(val);
+}
+
+uint64_t bytes_to_uint64(uint8_t *bytes) {
+    uint64_t val = 0;
+    memcpy(&val, bytes, sizeof(val));
+    return TO_BIG_ENDIAN_64(val);
+}
+
+void uint16_to_bytes(uint16_t val, uint8_t *bytes) {
+    val = TO_BIG_ENDIAN_16(val);
+    memcpy(bytes, &val, sizeof(val));
+}
+
+void uint32_to_bytes(uint32_t val, uint8_t *bytes) {
+    val = TO_BIG_ENDIAN_32(val);
+    memcpy(bytes, &val, sizeof(val));
+}
+
+void uint64_to_bytes(uint64_t val, uint8_t *bytes) {
+    val = TO_BIG_ENDIAN_64(val);
+    memcpy(bytes, &val, sizeof(val));
+}
+
+int16_t bytes_to_int16(uint8_t *bytes) {
+    return (int16_t) bytes_to_uint16(bytes);
+}
+
+int32_t bytes_to_int32(uint8_t *bytes) {
+    return (int32_t) bytes_to_uint32(bytes);
+}
+
+int64_t bytes_to_int64(uint8_t *bytes) {
+    return (int64_t) bytes_to_uint64(bytes);
+}
+
+void int16_to_bytes(int16_t val, uint8_t *bytes) {
+    uint16_to_bytes((uint16_t) val, bytes);
+}
+
+void int32_to_bytes(int32_t val, uint8_t *bytes) {
+    uint32_to_bytes((uint32_t) val, bytes);
+}
+
+void int64_to_bytes(int64_t val, uint8_t *bytes) {
+    uint64_to_bytes((uint64_t) val, bytes);
+}
+
+float bytes_to_float(uint8_t *bytes) {
+    static_assert(sizeof(float) == 4, "Float must be 4 bytes");
+    uint32_t bits = bytes_to_uint32(bytes);
+    float val = 0.0;
+    memcpy(&val, &bits, sizeof(val));
+    return val;
+}
+
+double bytes_to_double(uint8_t *bytes) {
+    static_assert(sizeof(double) == 8, "Double must be 8 bytes");
+    uint64_t bits = bytes_to_uint64(bytes);
+    double val = 0.0;
+    memcpy(&val, &bits, sizeof(val));
+    return val;
+}
+
+void float_to_bytes(float val, uint8_t *bytes) {
+    static_assert(sizeof(float) == 4, "Float must be 4 bytes");
+    uint32_t bits = 0;
+    memcpy(&bits, &val, sizeof(bits));
+    uint32_to_bytes(bits, bytes);
+}
+
+void double_to_bytes(double val, uint8_t *bytes) {
+    static_assert(sizeof(double) == 8, "Double must be 8 bytes");
+    uint64_t bits = 0;
+    memcpy(&bits, &val, sizeof(bits));
+    uint64_to_bytes(bits, bytes);
+}
+
+#else
+
+static inline int is_big_endian() {
+    int i = 1;
+    return ! *((char *)&i);
+}
+
+uint16_t bytes_to_uint16(uint8_t *bytes) {
+    return (((uint16_t) bytes[0]) << 8)
+         + ((uint16_t) bytes[1]);
+}
+
+uint32_t bytes_to_uint32(uint8_t *bytes) {
+    return (((uint32_t) bytes[0]) << 24)
+         + (((uint32_t) bytes[1]) << 16)
+         + (((uint32_t) bytes[2]) << 8)
+         + ((uint32_t) bytes[3]);
+}
+
+uint64_t bytes_to_uint64(uint8_t *bytes) {
+    return (((uint64_t) bytes[0]) << 56)
+         + (((uint64_t) bytes[1]) << 48)
+         + (((uint64_t) bytes[2]) << 40)
+         + (((uint64_t) bytes[3]) << 32)
+         + (((uint64_t) bytes[4]) << 24)
+         + (((uint64_t) bytes[5]) << 16)
+         + (((uint64_t) bytes[6]) << 8)
+         + ((uint64_t) bytes[7]);
+}
+
+void uint16_to_bytes(uint16_t val, uint8_t *bytes) {
+    bytes[0] = (uint8_t) (val >> 8);
+    bytes[1] = (uint8_t) val;
+}
+
+void uint32_to_bytes(uint32_t val, uint8_t *bytes) {
+    bytes[0] = (uint8_t) (val >> 24);
+    bytes[1] = (uint8_t) (val >> 16);
+    bytes[2] = (uint8_t) (val >> 8);
+    bytes[3] = (uint8_t) val;
+}
+
+void uint64_to_bytes(uint64_t val, uint8_t *bytes) {
+    bytes[0] = (uint8_t) (val >> 56);
+    bytes[1] = (uint8_t) (val >> 48);
+    bytes[2] = (uint8_t) (val >> 40);
+    bytes[3] = (uint8_t) (val >> 32);
+    bytes[4] = (uint8_t) (val >> 24);
+    bytes[5] = (uint8_t) (val >> 16);
+    bytes[6] = (uint8_t) (val >> 8);
+    bytes[7] = (uint8_t) val;
+}
+
+int16_t bytes_to_int16(uint8_t *bytes) {
+    int16_t i = 0;
+    i += bytes[0];
+    i <<= (int16_t) 8;
+    i += bytes[1];
+    return (int16_t) i;
+}
+
+int32_t bytes_to_int32(uint8_t *bytes) {
+    int32_t i = 0;
+    i += bytes[0];
+    i <<= (int32_t) 8;
+    i += bytes[1];
+    i <<= (int32_t) 8;
+    i += bytes[2];
+    i <<= (int32_t) 8;
+    i += bytes[3];
+    return (int32_t) i;
+}
+
+int64_t bytes_to_int64(uint8_t *bytes) {
+    int64_t i = 0;
+    i += bytes[0];
+    i <<= (int64_t) 8;
+    i += bytes[1];
+    i <<= (int64_t) 8;
+    i += bytes[2];
+    i <<= (int64_t) 8;
+    i += bytes[3];
+    i <<= (int64_t) 8;
+    i += bytes[4];
+    i <<= (int64_t) 8;
+    i += bytes[5];
+    i <<= (int64_t) 8;
+    i += bytes[6];
+    i <<= (int64_t) 8;
+    i += bytes[7];
+    return (int64_t) i;
+}
+
+void int16_to_bytes(int16_t val, uint8_t *bytes) {
+    bytes[1] = (uint8_t) val;
+    val >>= (int16_t) 8;
+    bytes[0] = (uint8_t) val;
+}
+
+void int32_to_bytes(int32_t val, uint8_t *bytes) {
+    bytes[3] = (uint8_t) val;
+    val >>= (int32_t) 8;
+    bytes[2] = (uint8_t) val;
+    val >>= (int32_t) 8;
+    bytes[1] = (uint8_t) val;
+    val >>= (int32_t) 8;
+    bytes[0] = (uint8_t) val;
+}
+
+void int64_to_bytes(int64_t val, uint8_t *bytes) {
+    bytes[7] = (uint8_t) val;
+    val >>= (int64_t) 8;
+    bytes[6] = (uint8_t) val;
+    val >>= (int64_t) 8;
+    bytes[5] = (uint8_t) val;
+    val >>= (int64_t) 8;
+    bytes[4] = (uint8_t) val;
+    val >>= (int64_t) 8;
+    bytes[3] = (uint8_t) val;
+    val >>= (int64_t) 8;
+    bytes[2] = (uint8_t) val;
+    val >>= (int64_t) 8;
+    bytes[1] = (uint8_t) val;
+    val >>= (int64_t) 8;
+    bytes[0] = (uint8_t) val;
+}
+
+float bytes_to_float(uint8_t *bytes) {
+    static_assert(sizeof(float) == 4, "Float must be 4 bytes");
+    // Interpret byte array as float, correct alignment neccessary for cast
+    if (is_big_endian()) {
+        alignas(alignof(float)) uint8_t b[4] = {bytes[0], bytes[1], bytes[2], bytes[3]};
+        return *((float *) b);
+    } else {
+        alignas(alignof(float)) float i = 0.0;
+        alignas(alignof(float)) uint8_t b[4] = {bytes[3], bytes[2], bytes[1], bytes[0]};
+        i = *((float *) &b);
+        return i;
+    }
+}
+
+double bytes_to_double(uint8_t *bytes) {
+    static_assert(sizeof(double) == 8, "Double must be 8 bytes");
+    // Interpret byte array as double, correct alignment neccessary for cast
+    if (is_big_endian()) {
+        alignas(alignof(double)) uint8_t b[8] = {
+            bytes[0],
+            bytes[1],
+            bytes[2],
+            bytes[3],
+            bytes[4],
+            bytes[5],
+            bytes[6],
+            bytes[7]};
+        return *((double *) b);
+    } else {
+        alignas(alignof(double)) double i = 0.0;
+        alignas(alignof(double)) uint8_t b[8] = {
+            bytes[7],
+            bytes[6],
+            bytes[5],
+            bytes[4],
+            bytes[3],
+            bytes[2],
+            bytes[1],
+            bytes[0]};
+        i = *((double *) &b);
+        return i;
+    }
+}
+
+void float_to_bytes(float val, uint8_t *bytes) {
+    static_assert(sizeof(float) == 4, "Float must be 4 bytes");
+    uint8_t *p = (uint8_t *) &val;
+    if (is_big_endian()) {
+        bytes[0] = p[0];
+        bytes[1] = p[1];
+        bytes[2] = p[2];
+        bytes[3] = p[3];
+    } else {
+        bytes[0] = p[3];
+        bytes[1] = p[2];
+        bytes[2] = p[1];
+        bytes[3] = p[0];
+    }
+}
+
+void double_to_bytes(double val, uint8_t *bytes) {
+    static_assert(sizeof(double) == 8, "Double must be 8 bytes");
+    uint8_t *p = (uint8_t *) &val;
+    if (is_big_endian()) {
+        bytes[0] = p[0];
+        bytes[1] = p[1];
+        bytes[2] = p[2];
+        bytes[3] = p[3];
+        bytes[4] = p[4];
+        bytes[5] = p[5];
+        bytes[6] = p[6];
+        bytes[7] = p[7];
+    } else {
+        bytes[0] = p[7];
+        bytes[1] = p[6];
+        bytes[2] = p[5];
+        bytes[3] = p[4];
+        bytes[4] = p[3];
+        bytes[5] = p[2];
+        bytes[6] = p[1];
+        bytes[7] = p[0];
+    }
+}
+
+#endif
+
+uint8_t bytes_to_bool(uint8_t *bytes) {
+    return (*bytes) != 0;
+}
+
+void bool_to_bytes(uint8_t val, uint8_t *bytes) {
+    (*bytes) = val;
+}
+
+time_point bytes_to_time_point(uint8_t *bytes) {
+    return bytes_to_int64(bytes);
+}
+
+void time_point_to_bytes(time_point val, uint8_t *bytes) {
+    int64_to_bytes(val, bytes);
+}
+
+hh_mm_ss bytes_to_hh_mm_ss(uint8_t *bytes) {
+    hh_mm_ss time = {0};
+    time.hours = bytes_to_uint8(bytes);
+    time.minutes = bytes_to_uint8(bytes + 1);
+    time.seconds = bytes_to_uint8(bytes + 2);
+    return time;
+}
+
+void hh_mm_ss_to_bytes(hh_mm_ss val, uint8_t *bytes) {
+    uint8_to_bytes(val.hours, bytes);
+    uint8_to_bytes(val.minutes, bytes + 1);
+    uint8_to_bytes(val.seconds, bytes + 2);
+}
+
+date_range bytes_to_date_range(uint8_t *bytes) {
+    date_range range = {0};
+    range.from = bytes_to_time_point(bytes);
+    range.to = bytes_to_time_point(bytes + sizeof(time_point));
+    return range;
+}
+
+void date_range_to_bytes(date_range val, uint8_t *bytes) {
+    time_point_to_bytes(val.from, bytes);
+    time_point_to_bytes(val.to, bytes + sizeof(time_point));
+}
+
+time_range bytes_to_time_range(uint8_t *bytes) {
+    time_range range = {0};
+    range.from = bytes_to_hh_mm_ss(bytes);
+    range.to = bytes_to_hh_mm_ss(bytes + 3);
+    return range;
+}
+
+void time_range_to_bytes(time_range val, uint8_t *bytes) {
+    hh_mm_ss_to_bytes(val.from, bytes);
+    hh_mm_ss_to_bytes(val.to, bytes + 3);
+}
+
+zone_offset bytes_to_zone_offset(uint8_t *bytes) {
+    return bytes_to_int16(bytes);
+}
+
+void zone_offset_to_bytes(zone_offset val, uint8_t *bytes) {
+    int16_to_bytes(val, bytes);
+}
+
+zoned_time bytes_to_zoned_time(uint8_t *bytes) {
+    zoned_time time = {0};
+    time.time = bytes_to_time_point(bytes);
+    time.offset = bytes_to_zone_offset(bytes + sizeof(time_point));
+    return time;
+}
+
+void zoned_time_to_bytes(zoned_time val, uint8_t *bytes) {
+    time_point_to_bytes(val.time, bytes);
+    zone_offset_to_bytes(val.offset, bytes + sizeof(time_point));
+}
+
+fixp32 bytes_to_fixp32(uint8_t *bytes, int32_t scale) {
+    fixp32 val = {0};
+    val.unscaled = bytes_to_int32(bytes);
+    val.scale = scale;
+    return val;
+}
+
+void fixp32_to_bytes(fixp32 val, uint8_t *bytes) {
+    int32_to_bytes(val.unscaled, bytes);
+}
+
+fixp64 bytes_to_fixp64(uint8_t *bytes, int32_t scale) {
+    fixp64 val = {0};
+    val.unscaled = bytes_to_int64(bytes);
+    val.scale = scale;
+    return val;
+}
+
+void fixp64_to_bytes(fixp64 val, uint8_t *bytes) {
+    int64_to_bytes(val.unscaled, bytes);
+}
+
+#define FIXP_MAX_DIGITS 18
+
+static const int64_t FIXP_POW10[FIXP_MAX_DIGITS + 1] = {
+    1ll, 10ll, 100ll, 1000ll, 10000ll, 100000ll, 1000000ll, 10000000ll, 100000000ll, 1000000000ll,
+    10000000000ll, 100000000000ll, 1000000000000ll, 10000000000000ll, 100000000000000ll,
+    1000000000000000ll, 10000000000000000ll, 100000000000000000ll, 1000000000000000000ll
+};
+
+// Unsigned 128 bit value for products of 64 bit values
+typedef struct {
+    uint64_t hi;
+    uint64_t lo;
+} wide_uint;
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 native_wide_uint;
+#endif
+
+static inline uint64_t magnitude_int64(int64_t val) {
+    return val < 0 ? 0 - (uint64_t) val : (uint64_t) val;
+}
+
+static wide_uint multiply_wide(uint64_t a, uint64_t b) {
+    wide_uint product;
+#ifdef __SIZEOF_INT128__
+    native_wide_uint native = (native_wide_uint) a * b;
+    product.hi = (uint64_t) (native >> 64);
+    product.lo = (uint64_t) native;
+#else
+    uint64_t lo_lo = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+    uint64_t lo_hi = (a & 0xFFFFFFFF) * (b >> 32);
+    uint64_t hi_lo = (a >> 32) * (b & 0xFFFFFFFF);
+    uint64_t mid = (lo_lo >> 32) + (lo_hi & 0xFFFFFFFF) + (hi_lo & 0xFFFFFFFF);
+    product.lo = (lo_lo & 0xFFFFFFFF) | (mid << 32);
+    product.hi = (a >> 32) * (b >> 32) + (lo_hi >> 32) + (hi_lo >> 32) + (mid >> 32);
+#endif
+    return product;
+}
+
+static wide_uint add_wide(wide_uint val, uint64_t summand) {
+    val.lo += summand;
+    if (val.lo < summand) {
+        val.hi++;
+    }
+    return val;
+}
+
+// Truncating division, `divisor` must not be 0
+static wide_uint divide_wide(wide_uint val, uint64_t divisor) {
+    wide_uint quotient;
+#ifdef __SIZEOF_INT128__
+    native_wide_uint native = (((native_wide_uint) val.hi << 64) | val.lo) / divisor;
+    quotient.hi = (uint64_t) (native >> 64);
+    quotient.lo = (uint64_t) native;
+#else
+    uint64_t remainder = val.hi % divisor;
+    quotient.hi = val.hi / divisor;
+    quotient.lo = 0;
+    for (int bit = 63; bit >= 0; bit--) {
+        uint64_t carry = remainder >> 63;
+        remainder = (remainder << 1) | ((val.lo >> bit) & 1);
+        quotient.lo <<= 1;
+        if (carry || remainder >= divisor) {
+            remainder -= divisor;
+            quotient.lo |= 1;
+        }
+    }
+#endif
+    return quotient;
+}
+
+static int64_t saturate_wide(wide_uint magnitude, uint8_t negative) {
+    if (magnitude.hi != 0 || magnitude.lo > (uint64_t) INT64_MAX + negative) {
+        return negative ? INT64_MIN : INT64_MAX;
+    }
+    if (negative && magnitude.lo != 0) {
+        return -(int64_t) (magnitude.lo - 1) - 1;
+    }
+    return (int64_t) magnitude.lo;
+}
+
+// Convert `unscaled` from scale `from` to scale `to`, saturating to the range of int64_t
+static int64_t rescale_int64(int64_t unscaled, int64_t from, int64_t to) {
+    if (to >= from) {
+        int64_t digits = to - from;
+        if (unscaled == 0 || digits == 0) {
+            return unscaled;
+        }
+        if (digits > FIXP_MAX_DIGITS) {
+            return unscaled < 0 ? INT64_MIN : INT64_MAX;
+        }
+        return saturate_multiply_int64(unscaled, FIXP_POW10[digits]);
+    }
+    int64_t digits = from - to;
+    if (digits > FIXP_MAX_DIGITS + 1) {
+        return 0;
+    }
+    if (digits > FIXP_MAX_DIGITS) {
+        // At most 9 remains, truncating it first doesn't change the rounding of the last digit
+        return divide_round_int64(unscaled / FIXP_POW10[FIXP_MAX_DIGITS], 10);
+    }
+    return divide_round_int64(unscaled, FIXP_POW10[digits]);
+}
+
+// Compare `x` to `y * 10 ^ digits`
+static int compare_scaled(int64_t x, int64_t y, int64_t digits) {
+    if (digits != 0 && y != 0 && (x < 0) == (y < 0)) {
+        if (digits > FIXP_MAX_DIGITS || magnitude_int64(y) > (uint64_t) (INT64_MAX / FIXP_POW10[digits])) {
+            // Scaled `y` is beyond the range of `x`
+            return y < 0 ? 1 : -1;
+        }
+        y *= FIXP_POW10[digits];
+    }
+    return (x > y) - (x < y);
+}
+
+int64_t multiply_divide_int64(int64_t a, int64_t b, int64_t divisor) {
+    uint8_t negative = (a < 0) != (b < 0);
+    wide_uint product = multiply_wide(magnitude_int64(a), magnitude_int64(b));
+    product = add_wide(product, (uint64_t) divisor / 2);
+    return saturate_wide(divide_wide(product, (uint64_t) divisor), negative);
+}
+
+fixp32 rescale_fixp32(fixp32 val, int32_t scale) {
+    fixp32 result = {0};
+    result.unscaled = saturate_int32(rescale_int64(val.unscaled, val.scale, scale));
+    result.scale = scale;
+    return result;
+}
+
+fixp64 rescale_fixp64(fixp64 val, int32_t scale) {
+    fixp64 result = {0};
+    result.unscaled = rescale_int64(val.unscaled, val.scale, scale);
+    result.scale = scale;
+    return result;
+}
+
+fixp32 add_fixp32(fixp32 a, fixp32 b) {
+    int64_t summand = rescale_int64(b.unscaled, b.scale, a.scale);
+    a.unscaled = saturate_int32(saturate_add_int64(a.unscaled, summand));
+    return a;
+}
+
+fixp64 add_fixp64(fixp64 a, fixp64 b) {
+    int64_t summand = rescale_int64(b.unscaled, b.scale, a.scale);
+    a.unscaled = saturate_add_int64(a.unscaled, summand);
+    return a;
+}
+
+fixp32 multiply_fixp32(fixp32 a, fixp32 b) {
+    // Product of 32 bit values is exact in 64 bits
+    int64_t product = (int64_t) a.unscaled * b.unscaled;
+    a.unscaled = saturate_int32(rescale_int64(product, (int64_t) a.scale + b.scale, a.scale));
+    return a;
+}
+
+fixp64 multiply_fixp64(fixp64 a, fixp64 b) {
+    uint8_t negative = (a.unscaled < 0) != (b.unscaled < 0);
+    wide_uint product = multiply_wide(magnitude_int64(a.unscaled), magnitude_int64(b.unscaled));
+    int64_t digits = b.scale;
+    if (digits <= 0) {
+        a.unscaled = rescale_int64(saturate_wide(product, negative), 0, -digits);
+        return a;
+    }
+    // Truncating in steps keeps the rounding of the last step exact
+    while (digits > FIXP_MAX_DIGITS) {
+        product = divide_wide(product, (uint64_t) FIXP_POW10[FIXP_MAX_DIGITS]);
+        digits -= FIXP_MAX_DIGITS;
+    }
+    product = add_wide(product, (uint64_t) FIXP_POW10[digits] / 2);
+    a.unscaled = saturate_wide(divide_wide(product, (uint64_t) FIXP_POW10[digits]), negative);
+    return a;
+}
+
+int compare_fixp32(fixp32 a, fixp32 b) {
+    fixp64 wide_a = {a.unscaled, a.scale};
+    fixp64 wide_b = {b.unscaled, b.scale};
+    return compare_fixp64(wide_a, wide_b);
+}
+
+int compare_fixp64(fixp64 a, fixp64 b) {
+    if (a.scale >= b.scale) {
+        return compare_scaled(a.unscaled, b.unscaled, (int64_t) a.scale - b.scale);
+    }
+    return -compare_scaled(b.unscaled, a.unscaled, (int64_t) b.scale - a.scale);
+}
+
+int32_t fixp32_to_int32(fixp32 val, int32_t scale) {
+    return rescale_fixp32(val, scale).unscaled;
+}
+
+int64_t fixp64_to_int64(fixp64 val, int32_t scale) {
+    return rescale_fixp64(val, scale).unscaled;
+}
+
+#ifdef EPUT_NATIVE_SWAP
+
+#if defined(__SSE2__) && defined(__GNUC__)
+static inline __m128i swap_16_sse2(__m128i words) {
+    return _mm_or_si128(_mm_slli_epi16(words, 8), _mm_srli_epi16(words, 8));
+}
+
+static inline __m128i swap_32_sse2(__m128i words) {
+    words = _mm_shufflelo_epi16(words, _MM_SHUFFLE(2, 3, 0, 1));
+    words = _mm_shufflehi_epi16(words, _MM_SHUFFLE(2, 3, 0, 1));
+    return swap_16_sse2(words);
+}
+
+static inline __m128i swap_64_sse2(__m128i words) {
+    return swap_32_sse2(_mm_shuffle_epi32(words, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+#endif
+
+// Reverse the byte order of `count` consecutive words of `size` bytes in place, 16 bytes at a time if possible
+static void swap_words(uint8_t *data, size_t size, size_t count) {
+    size_t length = size * count;
+    size_t index = 0;
+#if defined(__SSE2__) && defined(__GNUC__)
+    for (; index + 16 <= length; index += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *) (data + index));
+        if (size == 2) {
+            chunk = swap_16_sse2(chunk);
+        } else if (size == 4) {
+            chunk = swap_32_sse2(chunk);
+        } else {
+            chunk = swap_64_sse2(chunk);
+        }
+        _mm_storeu_si128((__m128i *) (data + index), chunk);
+    }
+#elif defined(__ARM_NEON)
+    for (; index + 16 <= length; index += 16) {
+        uint8x16_t chunk = vld1q_u8(data + index);
+        if (size == 2) {
+            chunk = vrev16q_u8(chunk);
+        } else if (size == 4) {
+            chunk = vrev32q_u8(chunk);
+        } else {
+            chunk = vrev64q_u8(chunk);
+        }
+        vst1q_u8(data + index, chunk);
+    }
+#endif
+    for (; index < length; index += size) {
+        if (size == 2) {
+            uint16_t val = 0;
+            memcpy(&val, data + index, sizeof(val));
+            val = TO_BIG_ENDIAN_16(val);
+            memcpy(data + index, &val, sizeof(val));
+        } else if (size == 4) {
+            uint32_t val = 0;
+            memcpy(&val, data + index, sizeof(val));
+            val = TO_BIG_ENDIAN_32(val);
+            memcpy(data + index, &val, sizeof(val));
+        } else {
+            uint64_t val = 0;
+            memcpy(&val, data + index, sizeof(val));
+            val = TO_BIG_ENDIAN_64(val);
+            memcpy(data + index, &val, sizeof(val));
+        }
+    }
+}
+
+#else
+
+static void swap_words(uint8_t *data, size_t size, size_t count) {
+    (void) data;
+    (void) size;
+    (void) count;
+}
+
+#endif
+
+#ifdef EPUT_NATIVE_CONVERSION
+#define ARRAY_FAST_PATH 1
+#else
+#define ARRAY_FAST_PATH 0
+#endif
+
+// Values stored without gaps are copied at once and swapped in place, other layouts use the scalar converter per value
+#define ARRAY_CONVERTERS(name, type) \
+    void bytes_to_##name##_array(uint8_t *bytes, type *vals, size_t count, size_t stride) { \
+        if (ARRAY_FAST_PATH && stride == sizeof(type)) { \
+            memcpy(vals, bytes, count * sizeof(type)); \
+            if (sizeof(type) > 1) { \
+                swap_words((uint8_t *) vals, sizeof(type), count); \
+            } \
+            return; \
+        } \
+        for (size_t i = 0; i < count; i++) { \
+            *(type *) ((uint8_t *) vals + i * stride) = bytes_to_##name(bytes + i * sizeof(type)); \
+        } \
+    } \
+    \
+    void name##_array_to_bytes(type *vals, uint8_t *bytes, size_t count, size_t stride) { \
+        if (ARRAY_FAST_PATH && stride == sizeof(type)) { \
+            memcpy(bytes, vals, count * sizeof(type)); \
+            if (sizeof(type) > 1) { \
+                swap_words(bytes, sizeof(type), count); \
+            } \
+            return; \
+        } \
+        for (size_t i = 0; i < count; i++) { \
+            name##_to_bytes(*(type *) ((uint8_t *) vals + i * stride), bytes + i * sizeof(type)); \
+        } \
+    }
+
+ARRAY_CONVERTERS(uint8, uint8_t)
+ARRAY_CONVERTERS(uint16, uint16_t)
+ARRAY_CONVERTERS(uint32, uint32_t)
+ARRAY_CONVERTERS(uint64, uint64_t)
+ARRAY_CONVERTERS(int8, int8_t)
+ARRAY_CONVERTERS(int16, int16_t)
+ARRAY_CONVERTERS(int32, int32_t)
+ARRAY_CONVERTERS(int64, int64_t)
+ARRAY_CONVERTERS(float, float)
+ARRAY_CONVERTERS(double, double)
+
+// Adapted from https://stackoverflow.com/a/744822
+uint8_t ends_with(const char *str, size_t str_len, const char *suffix) {
+    if (!str || !suffix) {
+        return 0;
+    }
+    size_t lensuffix = strlen(suffix);
+    if (lensuffix >  str_len) {
+        return 0;
+    }
+    return strncmp(str + str_len - lensuffix, suffix, lensuffix) == 0;
+}
+
+// Adapted from https://stackoverflow.com/a/744822
+uint8_t starts_with(const char *str, size_t str_len, const char *prefix) {
+    if (!str || !prefix) {
+        return 0;
+    }
+    size_t prefix_len = strlen(prefix);
+    if (prefix_len >  str_len) {
+        return 0;
+    }
+    return strncmp(str, prefix, prefix_len) == 0;
+}
+
+uint8_t type_valid(uint8_t *bytes, size_t len) {
+    return len >= RECORD_TYPE_SCHEME_LENGTH
+        && memcmp(bytes, RECORD_TYPE_SCHEME, RECORD_TYPE_SCHEME_LENGTH) == 0;
+}
+
+// Returns index of the first byte that is not a NULL TLV, or `buf_len` if there is none
+static size_t skip_null_tlvs(uint8_t *buf, size_t buf_len, size_t index) {
+#if defined(__SSE2__) && defined(__GNUC__)
+    const __m128i zero = _mm_setzero_si128();
+    while (index + 16 <= buf_len) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *) (buf + index));
+        unsigned int non_null = ((unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zero))) ^ 0xFFFFu;
+        if (non_null != 0) {
+            return index + (size_t) __builtin_ctz(non_null);
+        }
+        index += 16;
+    }
+#elif defined(__ARM_NEON)
+    while (index + 16 <= buf_len) {
+        uint64x2_t chunk = vreinterpretq_u64_u8(vld1q_u8(buf + index));
+        if ((vgetq_lane_u64(chunk, 0) | vgetq_lane_u64(chunk, 1)) != 0) {
+            break;
+        }
+        index += 16;
+    }
+#else
+    while (index + 8 <= buf_len) {
+        uint64_t chunk = 0;
+        memcpy(&chunk, buf + index, sizeof(chunk));
+        if (chunk != 0) {
+            break;
+        }
+        index += 8;
+    }
+#endif
+    while (index < buf_len && buf[index] == TLV_TYPE_NULL) {
+        index += 1;
+    }
+    return index;
+}
+
+int get_next_tlv(uint8_t *buf, size_t buf_len, tlv_cursor *cursor, tlv_block *tlv) {
+    size_t index = skip_null_tlvs(buf, buf_len, cursor->index);
+    cursor->index = index;
+    if (index >= buf_len || buf[index] == TLV_TYPE_TERMINATOR) {
+        return ERR_TLV_END;
+    }
+    uint8_t type = buf[index];
+    uint16_t length = 0;
+    index += 1;
+    if (buf_len < index + 1) {
+        return ERR_TLV_TRUNCATED;
+    }
+    if (buf[index] == 0xFF) {
+        // Size is 3 bytes, byte 2 + 3 are actual size
+        if (buf_len < index + 3) {
+            return ERR_TLV_TRUNCATED;
+        }
+        length = (((uint16_t) buf[index + 1]) << 8) + ((uint16_t) buf[index + 2]);
+        index += 3;
+        if (length == 0xFFFF) {
+            // Value is reserved - treat as invalid
+            return ERR_TLV_INVALID;
+        }
+    } else {
+        // Size is 1 byte
+        length = buf[index];
+        index += 1;
+    }
+    tlv->type = type;
+    tlv->length = length;
+    tlv->value_offset = index;
+    cursor->index = index + length;
+    return SUCCESS;
+}
+
+int find_tlv(uint8_t *buf, size_t buf_len, tlv_cursor *cursor, uint8_t type, tlv_block *tlv) {
+    int ret = get_next_tlv(buf, buf_len, cursor, tlv);
+    while (ret == SUCCESS && tlv->type != type) {
+        ret = get_next_tlv(buf, buf_len, cursor, tlv);
+    }
+    return ret;
+}
+
+uint16_t get_ndef_tlv_offset(uint8_t *buf, size_t buf_len, size_t *offset_p) {
+    EPUT_TRACE_BEGIN(EPUT_TRACE_TLV_SCAN);
+    tlv_cursor cursor = {0};
+    tlv_block tlv = {0};
+    uint16_t length = 0;
+    if (find_tlv(buf, buf_len, &cursor, TLV_TYPE_NDEF, &tlv) == SUCCESS) {
+        *offset_p = tlv.value_offset;
+        length = tlv.length;
+        cursor.index = tlv.value_offset;
+    }
+    EPUT_TRACE_END(EPUT_TRACE_TLV_SCAN, cursor.index < buf_len ? cursor.index : buf_len);
+    return length;
+}
+
+static int read_record(uint8_t *buf, size_t buf_len, ndef_record *record) {
+    uint8_t flags = 0;
+    uint8_t *type = NULL;
+    uint8_t type_length = 0;
+    uint8_t *id = NULL;
+    uint8_t id_length = 0;
+    uint32_t payload_length = 0;
+    uint8_t *payload = NULL;
+    
+    if (buf_len < 2) {
+        return ERR_REC_BUF_TRUNCATED;
+    }
+    flags = buf[0];
+    uint8_t tnf = flags & 0x07;
+    uint8_t id_length_present = flags & 0x08;
+    uint8_t short_record = flags & 0x10;
+    size_t pl_length = short_record > 0 ? 1 : 4;
+    size_t idl_length = id_length_present > 0 ? 1 : 0;
+    if (buf_len < 2 + pl_length + idl_length) {
+        return ERR_REC_BUF_TRUNCATED;
+    }
+    type_length = buf[1];
+    if (short_record > 0) {
+        payload_length = buf[2];
+    } else {
+        payload_length = bytes_to_uint32(buf + 2);
+    }
+    if (id_length_present > 0) {
+        id_length = buf[2 + pl_length];
+    }
+    size_t header_length = 2 + pl_length + idl_length + type_length + id_length;
+    // Compare with the remaining length, adding the payload length of long records could wrap around
+    if (buf_len < header_length || payload_length > buf_len - header_length) {
+        return ERR_REC_BUF_TRUNCATED;
+    }
+    if (payload_length > (size_t) INT_MAX - header_length) {
+        // Record length can't be returned, only possible with buffers larger than any tag
+        return ERR_REC_BUF_TRUNCATED;
+    }
+    type = buf + 2 + pl_length + idl_length;
+    if (id_length > 0) {
+        id = type + type_length;
+    }
+    payload = buf + header_length;
+
+    record->tnf = tnf;
+    record->type_length = type_length;
+    record->type = type;
+    record->id_length = id_length;
+    record->id = id;
+    record->payload_length = payload_length;
+    record->payload = payload;
+    return (int) (header_length + payload_length);
+}
+
+int get_record(uint8_t *buf, size_t buf_len, ndef_record *record) {
+    EPUT_TRACE_BEGIN(EPUT_TRACE_RECORD);
+    int ret = read_record(buf, buf_len, record);
+    EPUT_TRACE_END(EPUT_TRACE_RECORD, ret > 0 ? (size_t) ret : 0);
+    return ret;
+}
+
+int get_data_record(uint8_t *buf, size_t buf_len, ndef_record *data_rec) {
+    int ret = get_record(buf, buf_len, data_rec);
+    if (ret < 0) {
+        return ret;
+    } else if (data_rec->tnf != TNF_URI || !type_valid(data_rec->type, data_rec->type_length)) {
+        return ERR_REC_WRONG_TYPE;
+    }
+    return ret;
+}
+
+int get_records(
+    uint8_t *buf,
+    size_t buf_len,
+    ndef_record *meta_rec,
+    ndef_record *data_rec) {
+    int ret = get_data_record(buf, buf_len, data_rec);
+    if (ret < 0) {
+        return ret;
+    }
+    ret = get_record(buf + ret, buf_len - ret, meta_rec);
+    if (ret < 0) {
+        return ret;
+    } else if (meta_rec->tnf != TNF_URI || !type_valid(meta_rec->type, meta_rec->type_length)) {
+        return ERR_REC_WRONG_TYPE;
+    }
+    return SUCCESS;
+}
+
+static uint8_t record_matches(ndef_record *record, ndef_record_filter *filter) {
+    if (filter == NULL) {
+        return 1;
+    }
+    if (filter->tnf != TNF_ANY && filter->tnf != record->tnf) {
+        return 0;
+    }
+    // Empty prefixes may be NULL, memcmp must not be called with them
+    return filter->type_prefix_length == 0
+        || (record->type_length >= filter->type_prefix_length
+            && memcmp(record->type, filter->type_prefix, filter->type_prefix_length) == 0);
+}
+
+int get_next_record(
+    uint8_t *buf,
+    size_t buf_len,
+    ndef_record_cursor *cursor,
+    ndef_record_filter *filter,
+    ndef_record *record) {
+    while (!cursor->end && cursor->index < buf_len) {
+        uint8_t flags = buf[cursor->index];
+        int ret = get_record(buf + cursor->index, buf_len - cursor->index, record);
+        if (ret < 0) {
+            return ret;
+        }
+        cursor->index += ret;
+        cursor->end = (flags & RECORD_FLAG_ME) != 0;
+        if (record_matches(record, filter)) {
+            return SUCCESS;
+        }
+    }
+    return ERR_REC_END;
+}
+
+int get_all_records(
+    uint8_t *buf,
+    size_t buf_len,
+    ndef_record_filter *filter,
+    ndef_record *arena,
+    size_t capacity,
+    size_t *count) {
+    ndef_record_cursor cursor = {0};
+    ndef_record record;
+    *count = 0;
+    int ret = get_next_record(buf, buf_len, &cursor, filter, &record);
+    while (ret == SUCCESS) {
+        if (*count == capacity) {
+            return ERR_REC_ARENA_FULL;
+        }
+        arena[(*count)++] = record;
+        ret = get_next_record(buf, buf_len, &cursor, filter, &record);
+    }
+    return ret == ERR_REC_END ? SUCCESS : ret;
+}
+
+void ndef_stream_init(ndef_stream *stream, uint8_t *buf, size_t capacity) {
+    stream->buf = buf;
+    stream->capacity = capacity;
+    stream->length = 0;
+    stream->state = NDEF_STREAM_STATE_TLV;
+    stream->cursor.index = 0;
+    stream->ndef_offset = 0;
+    stream->ndef_length = 0;
+}
+
+static int ndef_stream_find_tlv(ndef_stream *stream) {
+    tlv_block tlv = {0};
+    int ret = find_tlv(stream->buf, stream->length, &(stream->cursor), TLV_TYPE_NDEF, &tlv);
+    if (ret == SUCCESS) {
+        stream->ndef_offset = tlv.value_offset;
+        stream->ndef_length = tlv.length;
+        stream->state = NDEF_STREAM_STATE_RECORD;
+        return SUCCESS;
+    } else if (ret == ERR_TLV_TRUNCATED
+            || (ret == ERR_TLV_END && stream->cursor.index >= stream->length)) {
+        // TLV header or value of skipped TLV not received yet
+        return NDEF_STREAM_NEED_MORE;
+    } else if (ret == ERR_TLV_END) {
+        return ERR_NO_NDEF_TLV;
+    }
+    return ret;
+}
+
+static int ndef_stream_read_record(ndef_stream *stream, ndef_record *data_rec) {
+    size_t available = 0;
+    if (stream->length > stream->ndef_offset) {
+        available = stream->length - stream->ndef_offset;
+    }
+    uint8_t complete = available >= stream->ndef_length;
+    if (complete) {
+        available = stream->ndef_length;
+    }
+    int ret = get_data_record(stream->buf + stream->ndef_offset, available, data_rec);
+    if (ret == ERR_REC_BUF_TRUNCATED && !complete) {
+        return NDEF_STREAM_NEED_MORE;
+    } else if (ret < 0) {
+        return ret;
+    }
+    stream->state = NDEF_STREAM_STATE_DONE;
+    return SUCCESS;
+}
+
+int ndef_stream_feed(ndef_stream *stream, uint8_t *data, size_t data_len, ndef_record *data_rec) {
+    if (stream->state == NDEF_STREAM_STATE_DONE) {
+        return SUCCESS;
+    }
+    if (data_len > stream->capacity - stream->length) {
+        return ERR_STREAM_BUF_FULL;
+    }
+    if (data != stream->buf + stream->length) {
+        memcpy(stream->buf + stream->length, data, data_len);
+    }
+    stream->length += data_len;
+    if (stream->state == NDEF_STREAM_STATE_TLV) {
+        int ret = ndef_stream_find_tlv(stream);
+        if (ret != SUCCESS) {
+            return ret;
+        }
+    }
+    return ndef_stream_read_record(stream, data_rec);
+}
+
+size_t add_byte_range(
+    byte_range *ranges,
+    size_t count,
+    size_t max_ranges,
+    byte_range range,
+    size_t data_len,
+    size_t page_size,
+    size_t base_offset) {
+    if (max_ranges == 0) {
+        return 0;
+    }
+    size_t start = range.offset;
+    size_t end = range.offset + range.length;
+    if (page_size > 1) {
+        start -= (base_offset + start) % page_size;
+        if (start > range.offset) {
+            // page starts before the data
+            start = 0;
+        }
+        size_t remainder = (base_offset + end) % page_size;
+        if (remainder > 0) {
+            end += page_size - remainder;
+        }
+    }
+    if (end > data_len) {
+        end = data_len;
+    }
+    if (count > 0) {
+        byte_range *last = ranges + count - 1;
+        if (start <= last->offset + last->length || count == max_ranges) {
+            if (end > last->offset + last->length) {
+                last->length = end - last->offset;
+            }
+            return count;
+        }
+    }
+    ranges[count].offset = start;
+    ranges[count].length = end - start;
+    return count + 1;
+}
+
+uint8_t is_option_selected(uint8_t* bitmap, size_t bitmap_len, uint8_t option) {
+    assert(option < (bitmap_len * 8));
+    size_t map_index = option / 8;
+    size_t byte_index = option % 8;
+    uint8_t b = bitmap[map_index];
+    uint8_t mask = 0x01 << byte_index;
+    return (b & mask) != 0;
+}
+
+// Bit n of the word is option `byte_index * 8 + n`, bytes beyond `bitmap_len` count as unselected
+static inline uint64_t load_bitmap_word(uint8_t *bitmap, size_t bitmap_len, size_t byte_index) {
+    size_t count = bitmap_len - byte_index;
+    uint64_t word = 0;
+#ifdef EPUT_NATIVE_CONVERSION
+    if (count >= 8) {
+        memcpy(&word, bitmap + byte_index, 8);
+        return TO_LITTLE_ENDIAN_64(word);
+    }
+#endif
+    if (count > 8) {
+        count = 8;
+    }
+    for (size_t i = 0; i < count; i++) {
+        word |= ((uint64_t) bitmap[byte_index + i]) << (8 * i);
+    }
+    return word;
+}
+
+static inline size_t count_bits(uint64_t word) {
+#ifdef __GNUC__
+    return (size_t) __builtin_popcountll(word);
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ull);
+    word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (size_t) ((word * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+// Index of the lowest set bit, `word` must not be 0
+static inline size_t lowest_bit(uint64_t word) {
+#ifdef __GNUC__
+    return (size_t) __builtin_ctzll(word);
+#else
+    size_t index = 0;
+    while ((word & 0x01) == 0) {
+        word >>= 1;
+        index += 1;
+    }
+    return index;
+#endif
+}
+
+uint64_t bitmap_to_uint64(uint8_t *bitmap, size_t bitmap_len) {
+    return load_bitmap_word(bitmap, bitmap_len, 0);
+}
+
+void uint64_to_bitmap(uint64_t options, uint8_t *bitmap, size_t bitmap_len) {
+    size_t count = bitmap_len < 8 ? bitmap_len : 8;
+    for (size_t i = 0; i < count; i++) {
+        bitmap[i] = (uint8_t) (options >> (8 * i));
+    }
+}
+
+size_t count_selected_options(uint8_t *bitmap, size_t bitmap_len) {
+    size_t count = 0;
+    for (size_t byte_index = 0; byte_index < bitmap_len; byte_index += 8) {
+        count += count_bits(load_bitmap_word(bitmap, bitmap_len, byte_index));
+    }
+    return count;
+}
+
+size_t find_next_selected_option(uint8_t *bitmap, size_t bitmap_len, size_t start) {
+    size_t byte_index = start / 8;
+    if (byte_index >= bitmap_len) {
+        return bitmap_len * 8;
+    }
+    uint64_t word = load_bitmap_word(bitmap, bitmap_len, byte_index) & (~0ull << (start % 8));
+    while (word == 0) {
+        byte_index += 8;
+        if (byte_index >= bitmap_len) {
+            return bitmap_len * 8;
+        }
+        word = load_bitmap_word(bitmap, bitmap_len, byte_index);
+    }
+    return byte_index * 8 + lowest_bit(word);
+}
+
+void select_option(uint8_t *bitmap, size_t bitmap_len, uint8_t option) {
+    if (option / 8 < bitmap_len) {
+        bitmap[option / 8] |= (uint8_t) (0x01 << (option % 8));
+    }
+}
+
+void deselect_option(uint8_t *bitmap, size_t bitmap_len, uint8_t option) {
+    if (option / 8 < bitmap_len) {
+        bitmap[option / 8] &= (uint8_t) ~(0x01 << (option % 8));
+    }
+}
+
+// Reflected CRC-32 with polynomial 0x04C11DB7, as used by zlib
+#ifdef EPUT_CRC32_SLICE_BY_8
+static const uint32_t crc32_table[8][256] = {
+    {
+        0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+        0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+        0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+        0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+        0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+        0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+        0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+        0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+        0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+        0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+        0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+        0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+        0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+        0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+        0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+        0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+        0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+        0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+        0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+        0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+        0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+        0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+        0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+        0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+        0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+        0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+        0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+        0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+        0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+        0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+        0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+        0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+    },
+    {
+        0x00000000, 0x191B3141, 0x32366282, 0x2B2D53C3, 0x646CC504, 0x7D77F445, 0x565AA786, 0x4F4196C7,
+        0xC8D98A08, 0xD1C2BB49, 0xFAEFE88A, 0xE3F4D9CB, 0xACB54F0C, 0xB5AE7E4D, 0x9E832D8E, 0x87981CCF,
+        0x4AC21251, 0x53D92310, 0x78F470D3, 0x61EF4192, 0x2EAED755, 0x37B5E614, 0x1C98B5D7, 0x05838496,
+        0x821B9859, 0x9B00A918, 0xB02DFADB, 0xA936CB9A, 0xE6775D5D, 0xFF6C6C1C, 0xD4413FDF, 0xCD5A0E9E,
+        0x958424A2, 0x8C9F15E3, 0xA7B24620, 0xBEA97761, 0xF1E8E1A6, 0xE8F3D0E7, 0xC3DE8324, 0xDAC5B265,
+        0x5D5DAEAA, 0x44469FEB, 0x6F6BCC28, 0x7670FD69, 0x39316BAE, 0x202A5AEF, 0x0B07092C, 0x121C386D,
+        0xDF4636F3, 0xC65D07B2, 0xED705471, 0xF46B6530, 0xBB2AF3F7, 0xA231C2B6, 0x891C9175, 0x9007A034,
+        0x179FBCFB, 0x0E848DBA, 0x25A9DE79, 0x3CB2EF38, 0x73F379FF, 0x6AE848BE, 0x41C51B7D, 0x58DE2A3C,
+        0xF0794F05, 0xE9627E44, 0xC24F2D87, 0xDB541CC6, 0x94158A01, 0x8D0EBB40, 0xA623E883, 0xBF38D9C2,
+        0x38A0C50D, 0x21BBF44C, 0x0A96A78F, 0x138D96CE, 0x5CCC0009, 0x45D73148, 0x6EFA628B, 0x77E153CA,
+        0xBABB5D54, 0xA3A06C15, 0x888D3FD6, 0x91960E97, 0xDED79850, 0xC7CCA911, 0xECE1FAD2, 0xF5FACB93,
+        0x7262D75C, 0x6B79E61D, 0x4054B5DE, 0x594F849F, 0x160E1258, 0x0F152319, 0x243870DA, 0x3D23419B,
+        0x65FD6BA7, 0x7CE65AE6, 0x57CB0925, 0x4ED03864, 0x0191AEA3, 0x188A9FE2, 0x33A7CC21, 0x2ABCFD60,
+        0xAD24E1AF, 0xB43FD0EE, 0x9F12832D, 0x8609B26C, 0xC94824AB, 0xD05315EA, 0xFB7E4629, 0xE2657768,
+        0x2F3F79F6, 0x362448B7, 0x1D091B74, 0x04122A35, 0x4B53BCF2, 0x52488DB3, 0x7965DE70, 0x607EEF31,
+        0xE7E6F3FE, 0xFEFDC2BF, 0xD5D0917C, 0xCCCBA03D, 0x838A36FA, 0x9A9107BB, 0xB1BC5478, 0xA8A76539,
+        0x3B83984B, 0x2298A90A, 0x09B5FAC9, 0x10AECB88, 0x5FEF5D4F, 0x46F46C0E, 0x6DD93FCD, 0x74C20E8C,
+        0xF35A1243, 0xEA412302, 0xC16C70C1, 0xD8774180, 0x9736D747, 0x8E2DE606, 0xA500B5C5, 0xBC1B8484,
+        0x71418A1A, 0x685ABB5B, 0x4377E898, 0x5A6CD9D9, 0x152D4F1E, 0x0C367E5F, 0x271B2D9C, 0x3E001CDD,
+        0xB9980012, 0xA0833153, 0x8BAE6290, 0x92B553D1, 0xDDF4C516, 0xC4EFF457, 0xEFC2A794, 0xF6D996D5,
+        0xAE07BCE9, 0xB71C8DA8, 0x9C31DE6B, 0x852AEF2A, 0xCA6B79ED, 0xD37048AC, 0xF85D1B6F, 0xE1462A2E,
+        0x66DE36E1, 0x7FC507A0, 0x54E85463, 0x4DF36522, 0x02B2F3E5, 0x1BA9C2A4, 0x30849167, 0x299FA026,
+        0xE4C5AEB8, 0xFDDE9FF9, 0xD6F3CC3A, 0xCFE8FD7B, 0x80A96BBC, 0x99B25AFD, 0xB29F093E, 0xAB84387F,
+        0x2C1C24B0, 0x350715F1, 0x1E2A4632, 0x07317773, 0x4870E1B4, 0x516BD0F5, 0x7A468336, 0x635DB277,
+        0xCBFAD74E, 0xD2E1E60F, 0xF9CCB5CC, 0xE0D7848D, 0xAF96124A, 0xB68D230B, 0x9DA070C8, 0x84BB4189,
+        0x03235D46, 0x1A386C07, 0x31153FC4, 0x280E0E85, 0x674F9842, 0x7E54A903, 0x5579FAC0, 0x4C62CB81,
+        0x8138C51F, 0x9823F45E, 0xB30EA79D, 0xAA1596DC, 0xE554001B, 0xFC4F315A, 0xD7626299, 0xCE7953D8,
+        0x49E14F17, 0x50FA7E56, 0x7BD72D95, 0x62CC1CD4, 0x2D8D8A13, 0x3496BB52, 0x1FBBE891, 0x06A0D9D0,
+        0x5E7EF3EC, 0x4765C2AD, 0x6C48916E, 0x7553A02F, 0x3A1236E8, 0x230907A9, 0x0824546A, 0x113F652B,
+        0x96A779E4, 0x8FBC48A5, 0xA4911B66, 0xBD8A2A27, 0xF2CBBCE0, 0xEBD08DA1, 0xC0FDDE62, 0xD9E6EF23,
+        0x14BCE1BD, 0x0DA7D0FC, 0x268A833F, 0x3F91B27E, 0x70D024B9, 0x69CB15F8, 0x42E6463B, 0x5BFD777A,
+        0xDC656BB5, 0xC57E5AF4, 0xEE530937, 0xF7483876, 0xB809AEB1, 0xA1129FF0, 0x8A3FCC33, 0x9324FD72
+    },
+    {
+        0x00000000, 0x01C26A37, 0x0384D46E, 0x0246BE59, 0x0709A8DC, 0x06CBC2EB, 0x048D7CB2, 0x054F1685,
+        0x0E1351B8, 0x0FD13B8F, 0x0D9785D6, 0x0C55EFE1, 0x091AF964, 0x08D89353, 0x0A9E2D0A, 0x0B5C473D,
+        0x1C26A370, 0x1DE4C947, 0x1FA2771E, 0x1E601D29, 0x1B2F0BAC, 0x1AED619B, 0x18ABDFC2, 0x1969B5F5,
+        0x1235F2C8, 0x13F798FF, 0x11B126A6, 0x10734C91, 0x153C5A14, 0x14FE3023, 0x16B88E7A, 0x177AE44D,
+        0x384D46E0, 0x398F2CD7, 0x3BC9928E, 0x3A0BF8B9, 0x3F44EE3C, 0x3E86840B, 0x3CC03A52, 0x3D025065,
+        0x365E1758, 0x379C7D6F, 0x35DAC336, 0x3418A901, 0x3157BF84, 0x3095D5B3, 0x32D36BEA, 0x331101DD,
+        0x246BE590, 0x25A98FA7, 0x27EF31FE, 0x262D5BC9, 0x23624D4C, 0x22A0277B, 0x20E69922, 0x2124F315,
+        0x2A78B428, 0x2BBADE1F, 0x29FC6046, 0x283E0A71, 0x2D711CF4, 0x2CB376C3, 0x2EF5C89A, 0x2F37A2AD,
+        0x709A8DC0, 0x7158E7F7, 0x731E59AE, 0x72DC3399, 0x7793251C, 0x76514F2B, 0x7417F172, 0x75D59B45,
+        0x7E89DC78, 0x7F4BB64F, 0x7D0D0816, 0x7CCF6221, 0x798074A4, 0x78421E93, 0x7A04A0CA, 0x7BC6CAFD,
+        0x6CBC2EB0, 0x6D7E4487, 0x6F38FADE, 0x6EFA90E9, 0x6BB5866C, 0x6A77EC5B, 0x68315202, 0x69F33835,
+        0x62AF7F08, 0x636D153F, 0x612BAB66, 0x60E9C151, 0x65A6D7D4, 0x6464BDE3, 0x662203BA, 0x67E0698D,
+        0x48D7CB20, 0x4915A117, 0x4B531F4E, 0x4A917579, 0x4FDE63FC, 0x4E1C09CB, 0x4C5AB792, 0x4D98DDA5,
+        0x46C49A98, 0x4706F0AF, 0x45404EF6, 0x448224C1, 0x41CD3244, 0x400F5873, 0x4249E62A, 0x438B8C1D,
+        0x54F16850, 0x55330267, 0x5775BC3E, 0x56B7D609, 0x53F8C08C, 0x523AAABB, 0x507C14E2, 0x51BE7ED5,
+        0x5AE239E8, 0x5B2053DF, 0x5966ED86, 0x58A487B1, 0x5DEB9134, 0x5C29FB03, 0x5E6F455A, 0x5FAD2F6D,
+        0xE1351B80, 0xE0F771B7, 0xE2B1CFEE, 0xE373A5D9, 0xE63CB35C, 0xE7FED96B, 0xE5B86732, 0xE47A0D05,
+        0xEF264A38, 0xEEE4200F, 0xECA29E56, 0xED60F461, 0xE82FE2E4, 0xE9ED88D3, 0xEBAB368A, 0xEA695CBD,
+        0xFD13B8F0, 0xFCD1D2C7, 0xFE976C9E, 0xFF5506A9, 0xFA1A102C, 0xFBD87A1B, 0xF99EC442, 0xF85CAE75,
+        0xF300E948, 0xF2C2837F, 0xF0843D26, 0xF1465711, 0xF4094194, 0xF5CB2BA3, 0xF78D95FA, 0xF64FFFCD,
+        0xD9785D60, 0xD8BA3757, 0xDAFC890E, 0xDB3EE339, 0xDE71F5BC, 0xDFB39F8B, 0xDDF521D2, 0xDC374BE5,
+        0xD76B0CD8, 0xD6A966EF, 0xD4EFD8B6, 0xD52DB281, 0xD062A404, 0xD1A0CE33, 0xD3E6706A, 0xD2241A5D,
+        0xC55EFE10, 0xC49C9427, 0xC6DA2A7E, 0xC7184049, 0xC25756CC, 0xC3953CFB, 0xC1D382A2, 0xC011E895,
+        0xCB4DAFA8, 0xCA8FC59F, 0xC8C97BC6, 0xC90B11F1, 0xCC440774, 0xCD866D43, 0xCFC0D31A, 0xCE02B92D,
+        0x91AF9640, 0x906DFC77, 0x922B422E, 0x93E92819, 0x96A63E9C, 0x976454AB, 0x9522EAF2, 0x94E080C5,
+        0x9FBCC7F8, 0x9E7EADCF, 0x9C381396, 0x9DFA79A1, 0x98B56F24, 0x99770513, 0x9B31BB4A, 0x9AF3D17D,
+        0x8D893530, 0x8C4B5F07, 0x8E0DE15E, 0x8FCF8B69, 0x8A809DEC, 0x8B42F7DB, 0x89044982, 0x88C623B5,
+        0x839A6488, 0x82580EBF, 0x801EB0E6, 0x81DCDAD1, 0x8493CC54, 0x8551A663, 0x8717183A, 0x86D5720D,
+        0xA9E2D0A0, 0xA820BA97, 0xAA6604CE, 0xABA46EF9, 0xAEEB787C, 0xAF29124B, 0xAD6FAC12, 0xACADC625,
+        0xA7F18118, 0xA633EB2F, 0xA4755576, 0xA5B73F41, 0xA0F829C4, 0xA13A43F3, 0xA37CFDAA, 0xA2BE979D,
+        0xB5C473D0, 0xB40619E7, 0xB640A7BE, 0xB782CD89, 0xB2CDDB0C, 0xB30FB13B, 0xB1490F62, 0xB08B6555,
+        0xBBD72268, 0xBA15485F, 0xB853F606, 0xB9919C31, 0xBCDE8AB4, 0xBD1CE083, 0xBF5A5EDA, 0xBE9834ED
+    },
+    {
+        0x00000000, 0xB8BC6765, 0xAA09C88B, 0x12B5AFEE, 0x8F629757, 0x37DEF032, 0x256B5FDC, 0x9DD738B9,
+        0xC5B428EF, 0x7D084F8A, 0x6FBDE064, 0xD7018701, 0x4AD6BFB8, 0xF26AD8DD, 0xE0DF7733, 0x58631056,
+        0x5019579F, 0xE8A530FA, 0xFA109F14, 0x42ACF871, 0xDF7BC0C8, 0x67C7A7AD, 0x75720843, 0xCDCE6F26,
+        0x95AD7F70, 0x2D111815, 0x3FA4B7FB, 0x8718D09E, 0x1ACFE827, 0xA2738F42, 0xB0C620AC, 0x087A47C9,
+        0xA032AF3E, 0x188EC85B, 0x0A3B67B5, 0xB28700D0, 0x2F503869, 0x97EC5F0C, 0x8559F0E2, 0x3DE59787,
+        0x658687D1, 0xDD3AE0B4, 0xCF8F4F5A, 0x7733283F, 0xEAE41086, 0x525877E3, 0x40EDD80D, 0xF851BF68,
+        0xF02BF8A1, 0x48979FC4, 0x5A22302A, 0xE29E574F, 0x7F496FF6, 0xC7F50893, 0xD540A77D, 0x6DFCC018,
+        0x359FD04E, 0x8D23B72B, 0x9F9618C5, 0x272A7FA0, 0xBAFD4719, 0x0241207C, 0x10F48F92, 0xA848E8F7,
+        0x9B14583D, 0x23A83F58, 0x311D90B6, 0x89A1F7D3, 0x1476CF6A, 0xACCAA80F, 0xBE7F07E1, 0x06C36084,
+        0x5EA070D2, 0xE61C17B7, 0xF4A9B859, 0x4C15DF3C, 0xD1C2E785, 0x697E80E0, 0x7BCB2F0E, 0xC377486B,
+        0xCB0D0FA2, 0x73B168C7, 0x6104C729, 0xD9B8A04C, 0x446F98F5, 0xFCD3FF90, 0xEE66507E, 0x56DA371B,
+        0x0EB9274D, 0xB6054028, 0xA4B0EFC6, 0x1C0C88A3, 0x81DBB01A, 0x3967D77F, 0x2BD27891, 0x936E1FF4,
+        0x3B26F703, 0x839A9066, 0x912F3F88, 0x299358ED, 0xB4446054, 0x0CF80731, 0x1E4DA8DF, 0xA6F1CFBA,
+        0xFE92DFEC, 0x462EB889, 0x549B1767, 0xEC277002, 0x71F048BB, 0xC94C2FDE, 0xDBF98030, 0x6345E755,
+        0x6B3FA09C, 0xD383C7F9, 0xC1366817, 0x798A0F72, 0xE45D37CB, 0x5CE150AE, 0x4E54FF40, 0xF6E89825,
+        0xAE8B8873, 0x1637EF16, 0x048240F8, 0xBC3E279D, 0x21E91F24, 0x99557841, 0x8BE0D7AF, 0x335CB0CA,
+        0xED59B63B, 0x55E5D15E, 0x47507EB0, 0xFFEC19D5, 0x623B216C, 0xDA874609, 0xC832E9E7, 0x708E8E82,
+        0x28ED9ED4, 0x9051F9B1, 0x82E4565F, 0x3A58313A, 0xA78F0983, 0x1F336EE6, 0x0D86C108, 0xB53AA66D,
+        0xBD40E1A4, 0x05FC86C1, 0x1749292F, 0xAFF54E4A, 0x322276F3, 0x8A9E1196, 0x982BBE78, 0x2097D91D,
+        0x78F4C94B, 0xC048AE2E, 0xD2FD01C0, 0x6A4166A5, 0xF7965E1C, 0x4F2A3979, 0x5D9F9697, 0xE523F1F2,
+        0x4D6B1905, 0xF5D77E60, 0xE762D18E, 0x5FDEB6EB, 0xC2098E52, 0x7AB5E937, 0x680046D9, 0xD0BC21BC,
+        0x88DF31EA, 0x3063568F, 0x22D6F961, 0x9A6A9E04, 0x07BDA6BD, 0xBF01C1D8, 0xADB46E36, 0x15080953,
+        0x1D724E9A, 0xA5CE29FF, 0xB77B8611, 0x0FC7E174, 0x9210D9CD, 0x2AACBEA8, 0x38191146, 0x80A57623,
+        0xD8C66675, 0x607A0110, 0x72CFAEFE, 0xCA73C99B, 0x57A4F122, 0xEF189647, 0xFDAD39A9, 0x45115ECC,
+        0x764DEE06, 0xCEF18963, 0xDC44268D, 0x64F841E8, 0xF92F7951, 0x41931E34, 0x5326B1DA, 0xEB9AD6BF,
+        0xB3F9C6E9, 0x0B45A18C, 0x19F00E62, 0xA14C6907, 0x3C9B51BE, 0x842736DB, 0x96929935, 0x2E2EFE50,
+        0x2654B999, 0x9EE8DEFC, 0x8C5D7112, 0x34E11677, 0xA9362ECE, 0x118A49AB, 0x033FE645, 0xBB838120,
+        0xE3E09176, 0x5B5CF613, 0x49E959FD, 0xF1553E98, 0x6C820621, 0xD43E6144, 0xC68BCEAA, 0x7E37A9CF,
+        0xD67F4138, 0x6EC3265D, 0x7C7689B3, 0xC4CAEED6, 0x591DD66F, 0xE1A1B10A, 0xF3141EE4, 0x4BA87981,
+        0x13CB69D7, 0xAB770EB2, 0xB9C2A15C, 0x017EC639, 0x9CA9FE80, 0x241599E5, 0x36A0360B, 0x8E1C516E,
+        0x866616A7, 0x3EDA71C2, 0x2C6FDE2C, 0x94D3B949, 0x090481F0, 0xB1B8E695, 0xA30D497B, 0x1BB12E1E,
+        0x43D23E48, 0xFB6E592D, 0xE9DBF6C3, 0x516791A6, 0xCCB0A91F, 0x740CCE7A, 0x66B96194, 0xDE0506F1
+    },
+    {
+        0x00000000, 0x3D6029B0, 0x7AC05360, 0x47A07AD0, 0xF580A6C0, 0xC8E08F70, 0x8F40F5A0, 0xB220DC10,
+        0x30704BC1, 0x0D106271, 0x4AB018A1, 0x77D03111, 0xC5F0ED01, 0xF890C4B1, 0xBF30BE61, 0x825097D1,
+        0x60E09782, 0x5D80BE32, 0x1A20C4E2, 0x2740ED52, 0x95603142, 0xA80018F2, 0xEFA06222, 0xD2C04B92,
+        0x5090DC43, 0x6DF0F5F3, 0x2A508F23, 0x1730A693, 0xA5107A83, 0x98705333, 0xDFD029E3, 0xE2B00053,
+        0xC1C12F04, 0xFCA106B4, 0xBB017C64, 0x866155D4, 0x344189C4, 0x0921A074, 0x4E81DAA4, 0x73E1F314,
+        0xF1B164C5, 0xCCD14D75, 0x8B7137A5, 0xB6111E15, 0x0431C205, 0x3951EBB5, 0x7EF19165, 0x4391B8D5,
+        0xA121B886, 0x9C419136, 0xDBE1EBE6, 0xE681C256, 0x54A11E46, 0x69C137F6, 0x2E614D26, 0x13016496,
+        0x9151F347, 0xAC31DAF7, 0xEB91A027, 0xD6F18997, 0x64D15587, 0x59B17C37, 0x1E1106E7, 0x23712F57,
+        0x58F35849, 0x659371F9, 0x22330B29, 0x1F532299, 0xAD73FE89, 0x9013D739, 0xD7B3ADE9, 0xEAD38459,
+        0x68831388, 0x55E33A38, 0x124340E8, 0x2F236958, 0x9D03B548, 0xA0639CF8, 0xE7C3E628, 0xDAA3CF98,
+        0x3813CFCB, 0x0573E67B, 0x42D39CAB, 0x7FB3B51B, 0xCD93690B, 0xF0F340BB, 0xB7533A6B, 0x8A3313DB,
+        0x0863840A, 0x3503ADBA, 0x72A3D76A, 0x4FC3FEDA, 0xFDE322CA, 0xC0830B7A, 0x872371AA, 0xBA43581A,
+        0x9932774D, 0xA4525EFD, 0xE3F2242D, 0xDE920D9D, 0x6CB2D18D, 0x51D2F83D, 0x167282ED, 0x2B12AB5D,
+        0xA9423C8C, 0x9422153C, 0xD3826FEC, 0xEEE2465C, 0x5CC29A4C, 0x61A2B3FC, 0x2602C92C, 0x1B62E09C,
+        0xF9D2E0CF, 0xC4B2C97F, 0x8312B3AF, 0xBE729A1F, 0x0C52460F, 0x31326FBF, 0x7692156F, 0x4BF23CDF,
+        0xC9A2AB0E, 0xF4C282BE, 0xB362F86E, 0x8E02D1DE, 0x3C220DCE, 0x0142247E, 0x46E25EAE, 0x7B82771E,
+        0xB1E6B092, 0x8C869922, 0xCB26E3F2, 0xF646CA42, 0x44661652, 0x79063FE2, 0x3EA64532, 0x03C66C82,
+        0x8196FB53, 0xBCF6D2E3, 0xFB56A833, 0xC6368183, 0x74165D93, 0x49767423, 0x0ED60EF3, 0x33B62743,
+        0xD1062710, 0xEC660EA0, 0xABC67470, 0x96A65DC0, 0x248681D0, 0x19E6A860, 0x5E46D2B0, 0x6326FB00,
+        0xE1766CD1, 0xDC164561, 0x9BB63FB1, 0xA6D61601, 0x14F6CA11, 0x2996E3A1, 0x6E369971, 0x5356B0C1,
+        0x70279F96, 0x4D47B626, 0x0AE7CCF6, 0x3787E546, 0x85A73956, 0xB8C710E6, 0xFF676A36, 0xC2074386,
+        0x4057D457, 0x7D37FDE7, 0x3A978737, 0x07F7AE87, 0xB5D77297, 0x88B75B27, 0xCF1721F7, 0xF2770847,
+        0x10C70814, 0x2DA721A4, 0x6A075B74, 0x576772C4, 0xE547AED4, 0xD8278764, 0x9F87FDB4, 0xA2E7D404,
+        0x20B743D5, 0x1DD76A65, 0x5A7710B5, 0x67173905, 0xD537E515, 0xE857CCA5, 0xAFF7B675, 0x92979FC5,
+        0xE915E8DB, 0xD475C16B, 0x93D5BBBB, 0xAEB5920B, 0x1C954E1B, 0x21F567AB, 0x66551D7B, 0x5B3534CB,
+        0xD965A31A, 0xE4058AAA, 0xA3A5F07A, 0x9EC5D9CA, 0x2CE505DA, 0x11852C6A, 0x562556BA, 0x6B457F0A,
+        0x89F57F59, 0xB49556E9, 0xF3352C39, 0xCE550589, 0x7C75D999, 0x4115F029, 0x06B58AF9, 0x3BD5A349,
+        0xB9853498, 0x84E51D28, 0xC34567F8, 0xFE254E48, 0x4C059258, 0x7165BBE8, 0x36C5C138, 0x0BA5E888,
+        0x28D4C7DF, 0x15B4EE6F, 0x521494BF, 0x6F74BD0F, 0xDD54611F, 0xE03448AF, 0xA794327F, 0x9AF41BCF,
+        0x18A48C1E, 0x25C4A5AE, 0x6264DF7E, 0x5F04F6CE, 0xED242ADE, 0xD044036E, 0x97E479BE, 0xAA84500E,
+        0x4834505D, 0x755479ED, 0x32F4033D, 0x0F942A8D, 0xBDB4F69D, 0x80D4DF2D, 0xC774A5FD, 0xFA148C4D,
+        0x78441B9C, 0x4524322C, 0x028448FC, 0x3FE4614C, 0x8DC4BD5C, 0xB0A494EC, 0xF704EE3C, 0xCA64C78C
+    },
+    {
+        0x00000000, 0xCB5CD3A5, 0x4DC8A10B, 0x869472AE, 0x9B914216, 0x50CD91B3, 0xD659E31D, 0x1D0530B8,
+        0xEC53826D, 0x270F51C8, 0xA19B2366, 0x6AC7F0C3, 0x77C2C07B, 0xBC9E13DE, 0x3A0A6170, 0xF156B2D5,
+        0x03D6029B, 0xC88AD13E, 0x4E1EA390, 0x85427035, 0x9847408D, 0x531B9328, 0xD58FE186, 0x1ED33223,
+        0xEF8580F6, 0x24D95353, 0xA24D21FD, 0x6911F258, 0x7414C2E0, 0xBF481145, 0x39DC63EB, 0xF280B04E,
+        0x07AC0536, 0xCCF0D693, 0x4A64A43D, 0x81387798, 0x9C3D4720, 0x57619485, 0xD1F5E62B, 0x1AA9358E,
+        0xEBFF875B, 0x20A354FE, 0xA6372650, 0x6D6BF5F5, 0x706EC54D, 0xBB3216E8, 0x3DA66446, 0xF6FAB7E3,
+        0x047A07AD, 0xCF26D408, 0x49B2A6A6, 0x82EE7503, 0x9FEB45BB, 0x54B7961E, 0xD223E4B0, 0x197F3715,
+        0xE82985C0, 0x23755665, 0xA5E124CB, 0x6EBDF76E, 0x73B8C7D6, 0xB8E41473, 0x3E7066DD, 0xF52CB578,
+        0x0F580A6C, 0xC404D9C9, 0x4290AB67, 0x89CC78C2, 0x94C9487A, 0x5F959BDF, 0xD901E971, 0x125D3AD4,
+        0xE30B8801, 0x28575BA4, 0xAEC3290A, 0x659FFAAF, 0x789ACA17, 0xB3C619B2, 0x35526B1C, 0xFE0EB8B9,
+        0x0C8E08F7, 0xC7D2DB52, 0x4146A9FC, 0x8A1A7A59, 0x971F4AE1, 0x5C439944, 0xDAD7EBEA, 0x118B384F,
+        0xE0DD8A9A, 0x2B81593F, 0xAD152B91, 0x6649F834, 0x7B4CC88C, 0xB0101B29, 0x36846987, 0xFDD8BA22,
+        0x08F40F5A, 0xC3A8DCFF, 0x453CAE51, 0x8E607DF4, 0x93654D4C, 0x58399EE9, 0xDEADEC47, 0x15F13FE2,
+        0xE4A78D37, 0x2FFB5E92, 0xA96F2C3C, 0x6233FF99, 0x7F36CF21, 0xB46A1C84, 0x32FE6E2A, 0xF9A2BD8F,
+        0x0B220DC1, 0xC07EDE64, 0x46EAACCA, 0x8DB67F6F, 0x90B34FD7, 0x5BEF9C72, 0xDD7BEEDC, 0x16273D79,
+        0xE7718FAC, 0x2C2D5C09, 0xAAB92EA7, 0x61E5FD02, 0x7CE0CDBA, 0xB7BC1E1F, 0x31286CB1, 0xFA74BF14,
+        0x1EB014D8, 0xD5ECC77D, 0x5378B5D3, 0x98246676, 0x852156CE, 0x4E7D856B, 0xC8E9F7C5, 0x03B52460,
+        0xF2E396B5, 0x39BF4510, 0xBF2B37BE, 0x7477E41B, 0x6972D4A3, 0xA22E0706, 0x24BA75A8, 0xEFE6A60D,
+        0x1D661643, 0xD63AC5E6, 0x50AEB748, 0x9BF264ED, 0x86F75455, 0x4DAB87F0, 0xCB3FF55E, 0x006326FB,
+        0xF135942E, 0x3A69478B, 0xBCFD3525, 0x77A1E680, 0x6AA4D638, 0xA1F8059D, 0x276C7733, 0xEC30A496,
+        0x191C11EE, 0xD240C24B, 0x54D4B0E5, 0x9F886340, 0x828D53F8, 0x49D1805D, 0xCF45F2F3, 0x04192156,
+        0xF54F9383, 0x3E134026, 0xB8873288, 0x73DBE12D, 0x6EDED195, 0xA5820230, 0x2316709E, 0xE84AA33B,
+        0x1ACA1375, 0xD196C0D0, 0x5702B27E, 0x9C5E61DB, 0x815B5163, 0x4A0782C6, 0xCC93F068, 0x07CF23CD,
+        0xF6999118, 0x3DC542BD, 0xBB513013, 0x700DE3B6, 0x6D08D30E, 0xA65400AB, 0x20C07205, 0xEB9CA1A0,
+        0x11E81EB4, 0xDAB4CD11, 0x5C20BFBF, 0x977C6C1A, 0x8A795CA2, 0x41258F07, 0xC7B1FDA9, 0x0CED2E0C,
+        0xFDBB9CD9, 0x36E74F7C, 0xB0733DD2, 0x7B2FEE77, 0x662ADECF, 0xAD760D6A, 0x2BE27FC4, 0xE0BEAC61,
+        0x123E1C2F, 0xD962CF8A, 0x5FF6BD24, 0x94AA6E81, 0x89AF5E39, 0x42F38D9C, 0xC467FF32, 0x0F3B2C97,
+        0xFE6D9E42, 0x35314DE7, 0xB3A53F49, 0x78F9ECEC, 0x65FCDC54, 0xAEA00FF1, 0x28347D5F, 0xE368AEFA,
+        0x16441B82, 0xDD18C827, 0x5B8CBA89, 0x90D0692C, 0x8DD55994, 0x46898A31, 0xC01DF89F, 0x0B412B3A,
+        0xFA1799EF, 0x314B4A4A, 0xB7DF38E4, 0x7C83EB41, 0x6186DBF9, 0xAADA085C, 0x2C4E7AF2, 0xE712A957,
+        0x15921919, 0xDECECABC, 0x585AB812, 0x93066BB7, 0x8E035B0F, 0x455F88AA, 0xC3CBFA04, 0x089729A1,
+        0xF9C19B74, 0x329D48D1, 0xB4093A7F, 0x7F55E9DA, 0x6250D962, 0xA90C0AC7, 0x2F987869, 0xE4C4ABCC
+    },
+    {
+        0x00000000, 0xA6770BB4, 0x979F1129, 0x31E81A9D, 0xF44F2413, 0x52382FA7, 0x63D0353A, 0xC5A73E8E,
+        0x33EF4E67, 0x959845D3, 0xA4705F4E, 0x020754FA, 0xC7A06A74, 0x61D761C0, 0x503F7B5D, 0xF64870E9,
+        0x67DE9CCE, 0xC1A9977A, 0xF0418DE7, 0x56368653, 0x9391B8DD, 0x35E6B369, 0x040EA9F4, 0xA279A240,
+        0x5431D2A9, 0xF246D91D, 0xC3AEC380, 0x65D9C834, 0xA07EF6BA, 0x0609FD0E, 0x37E1E793, 0x9196EC27,
+        0xCFBD399C, 0x69CA3228, 0x582228B5, 0xFE552301, 0x3BF21D8F, 0x9D85163B, 0xAC6D0CA6, 0x0A1A0712,
+        0xFC5277FB, 0x5A257C4F, 0x6BCD66D2, 0xCDBA6D66, 0x081D53E8, 0xAE6A585C, 0x9F8242C1, 0x39F54975,
+        0xA863A552, 0x0E14AEE6, 0x3FFCB47B, 0x998BBFCF, 0x5C2C8141, 0xFA5B8AF5, 0xCBB39068, 0x6DC49BDC,
+        0x9B8CEB35, 0x3DFBE081, 0x0C13FA1C, 0xAA64F1A8, 0x6FC3CF26, 0xC9B4C492, 0xF85CDE0F, 0x5E2BD5BB,
+        0x440B7579, 0xE27C7ECD, 0xD3946450, 0x75E36FE4, 0xB044516A, 0x16335ADE, 0x27DB4043, 0x81AC4BF7,
+        0x77E43B1E, 0xD19330AA, 0xE07B2A37, 0x460C2183, 0x83AB1F0D, 0x25DC14B9, 0x14340E24, 0xB2430590,
+        0x23D5E9B7, 0x85A2E203, 0xB44AF89E, 0x123DF32A, 0xD79ACDA4, 0x71EDC610, 0x4005DC8D, 0xE672D739,
+        0x103AA7D0, 0xB64DAC64, 0x87A5B6F9, 0x21D2BD4D, 0xE47583C3, 0x42028877, 0x73EA92EA, 0xD59D995E,
+        0x8BB64CE5, 0x2DC14751, 0x1C295DCC, 0xBA5E5678, 0x7FF968F6, 0xD98E6342, 0xE86679DF, 0x4E11726B,
+        0xB8590282, 0x1E2E0936, 0x2FC613AB, 0x89B1181F, 0x4C162691, 0xEA612D25, 0xDB8937B8, 0x7DFE3C0C,
+        0xEC68D02B, 0x4A1FDB9F, 0x7BF7C102, 0xDD80CAB6, 0x1827F438, 0xBE50FF8C, 0x8FB8E511, 0x29CFEEA5,
+        0xDF879E4C, 0x79F095F8, 0x48188F65, 0xEE6F84D1, 0x2BC8BA5F, 0x8DBFB1EB, 0xBC57AB76, 0x1A20A0C2,
+        0x8816EAF2, 0x2E61E146, 0x1F89FBDB, 0xB9FEF06F, 0x7C59CEE1, 0xDA2EC555, 0xEBC6DFC8, 0x4DB1D47C,
+        0xBBF9A495, 0x1D8EAF21, 0x2C66B5BC, 0x8A11BE08, 0x4FB68086, 0xE9C18B32, 0xD82991AF, 0x7E5E9A1B,
+        0xEFC8763C, 0x49BF7D88, 0x78576715, 0xDE206CA1, 0x1B87522F, 0xBDF0599B, 0x8C184306, 0x2A6F48B2,
+        0xDC27385B, 0x7A5033EF, 0x4BB82972, 0xEDCF22C6, 0x28681C48, 0x8E1F17FC, 0xBFF70D61, 0x198006D5,
+        0x47ABD36E, 0xE1DCD8DA, 0xD034C247, 0x7643C9F3, 0xB3E4F77D, 0x1593FCC9, 0x247BE654, 0x820CEDE0,
+        0x74449D09, 0xD23396BD, 0xE3DB8C20, 0x45AC8794, 0x800BB91A, 0x267CB2AE, 0x1794A833, 0xB1E3A387,
+        0x20754FA0, 0x86024414, 0xB7EA5E89, 0x119D553D, 0xD43A6BB3, 0x724D6007, 0x43A57A9A, 0xE5D2712E,
+        0x139A01C7, 0xB5ED0A73, 0x840510EE, 0x22721B5A, 0xE7D525D4, 0x41A22E60, 0x704A34FD, 0xD63D3F49,
+        0xCC1D9F8B, 0x6A6A943F, 0x5B828EA2, 0xFDF58516, 0x3852BB98, 0x9E25B02C, 0xAFCDAAB1, 0x09BAA105,
+        0xFFF2D1EC, 0x5985DA58, 0x686DC0C5, 0xCE1ACB71, 0x0BBDF5FF, 0xADCAFE4B, 0x9C22E4D6, 0x3A55EF62,
+        0xABC30345, 0x0DB408F1, 0x3C5C126C, 0x9A2B19D8, 0x5F8C2756, 0xF9FB2CE2, 0xC813367F, 0x6E643DCB,
+        0x982C4D22, 0x3E5B4696, 0x0FB35C0B, 0xA9C457BF, 0x6C636931, 0xCA146285, 0xFBFC7818, 0x5D8B73AC,
+        0x03A0A617, 0xA5D7ADA3, 0x943FB73E, 0x3248BC8A, 0xF7EF8204, 0x519889B0, 0x6070932D, 0xC6079899,
+        0x304FE870, 0x9638E3C4, 0xA7D0F959, 0x01A7F2ED, 0xC400CC63, 0x6277C7D7, 0x539FDD4A, 0xF5E8D6FE,
+        0x647E3AD9, 0xC209316D, 0xF3E12BF0, 0x55962044, 0x90311ECA, 0x3646157E, 0x07AE0FE3, 0xA1D90457,
+        0x579174BE, 0xF1E67F0A, 0xC00E6597, 0x66796E23, 0xA3DE50AD, 0x05A95B19, 0x34414184, 0x92364A30
+    },
+    {
+        0x00000000, 0xCCAA009E, 0x4225077D, 0x8E8F07E3, 0x844A0EFA, 0x48E00E64, 0xC66F0987, 0x0AC50919,
+        0xD3E51BB5, 0x1F4F1B2B, 0x91C01CC8, 0x5D6A1C56, 0x57AF154F, 0x9B0515D1, 0x158A1232, 0xD92012AC,
+        0x7CBB312B, 0xB01131B5, 0x3E9E3656, 0xF23436C8, 0xF8F13FD1, 0x345B3F4F, 0xBAD438AC, 0x767E3832,
+        0xAF5E2A9E, 0x63F42A00, 0xED7B2DE3, 0x21D12D7D, 0x2B142464, 0xE7BE24FA, 0x69312319, 0xA59B2387,
+        0xF9766256, 0x35DC62C8, 0xBB53652B, 0x77F965B5, 0x7D3C6CAC, 0xB1966C32, 0x3F196BD1, 0xF3B36B4F,
+        0x2A9379E3, 0xE639797D, 0x68B67E9E, 0xA41C7E00, 0xAED97719, 0x62737787, 0xECFC7064, 0x205670FA,
+        0x85CD537D, 0x496753E3, 0xC7E85400, 0x0B42549E, 0x01875D87, 0xCD2D5D19, 0x43A25AFA, 0x8F085A64,
+        0x562848C8, 0x9A824856, 0x140D4FB5, 0xD8A74F2B, 0xD2624632, 0x1EC846AC, 0x9047414F, 0x5CED41D1,
+        0x299DC2ED, 0xE537C273, 0x6BB8C590, 0xA712C50E, 0xADD7CC17, 0x617DCC89, 0xEFF2CB6A, 0x2358CBF4,
+        0xFA78D958, 0x36D2D9C6, 0xB85DDE25, 0x74F7DEBB, 0x7E32D7A2, 0xB298D73C, 0x3C17D0DF, 0xF0BDD041,
+        0x5526F3C6, 0x998CF358, 0x1703F4BB, 0xDBA9F425, 0xD16CFD3C, 0x1DC6FDA2, 0x9349FA41, 0x5FE3FADF,
+        0x86C3E873, 0x4A69E8ED, 0xC4E6EF0E, 0x084CEF90, 0x0289E689, 0xCE23E617, 0x40ACE1F4, 0x8C06E16A,
+        0xD0EBA0BB, 0x1C41A025, 0x92CEA7C6, 0x5E64A758, 0x54A1AE41, 0x980BAEDF, 0x1684A93C, 0xDA2EA9A2,
+        0x030EBB0E, 0xCFA4BB90, 0x412BBC73, 0x8D81BCED, 0x8744B5F4, 0x4BEEB56A, 0xC561B289, 0x09CBB217,
+        0xAC509190, 0x60FA910E, 0xEE7596ED, 0x22DF9673, 0x281A9F6A, 0xE4B09FF4, 0x6A3F9817, 0xA6959889,
+        0x7FB58A25, 0xB31F8ABB, 0x3D908D58, 0xF13A8DC6, 0xFBFF84DF, 0x37558441, 0xB9DA83A2, 0x7570833C,
+        0x533B85DA, 0x9F918544, 0x111E82A7, 0xDDB48239, 0xD7718B20, 0x1BDB8BBE, 0x95548C5D, 0x59FE8CC3,
+        0x80DE9E6F, 0x4C749EF1, 0xC2FB9912, 0x0E51998C, 0x04949095, 0xC83E900B, 0x46B197E8, 0x8A1B9776,
+        0x2F80B4F1, 0xE32AB46F, 0x6DA5B38C, 0xA10FB312, 0xABCABA0B, 0x6760BA95, 0xE9EFBD76, 0x2545BDE8,
+        0xFC65AF44, 0x30CFAFDA, 0xBE40A839, 0x72EAA8A7, 0x782FA1BE, 0xB485A120, 0x3A0AA6C3, 0xF6A0A65D,
+        0xAA4DE78C, 0x66E7E712, 0xE868E0F1, 0x24C2E06F, 0x2E07E976, 0xE2ADE9E8, 0x6C22EE0B, 0xA088EE95,
+        0x79A8FC39, 0xB502FCA7, 0x3B8DFB44, 0xF727FBDA, 0xFDE2F2C3, 0x3148F25D, 0xBFC7F5BE, 0x736DF520,
+        0xD6F6D6A7, 0x1A5CD639, 0x94D3D1DA, 0x5879D144, 0x52BCD85D, 0x9E16D8C3, 0x1099DF20, 0xDC33DFBE,
+        0x0513CD12, 0xC9B9CD8C, 0x4736CA6F, 0x8B9CCAF1, 0x8159C3E8, 0x4DF3C376, 0xC37CC495, 0x0FD6C40B,
+        0x7AA64737, 0xB60C47A9, 0x3883404A, 0xF42940D4, 0xFEEC49CD, 0x32464953, 0xBCC94EB0, 0x70634E2E,
+        0xA9435C82, 0x65E95C1C, 0xEB665BFF, 0x27CC5B61, 0x2D095278, 0xE1A352E6, 0x6F2C5505, 0xA386559B,
+        0x061D761C, 0xCAB77682, 0x44387161, 0x889271FF, 0x825778E6, 0x4EFD7878, 0xC0727F9B, 0x0CD87F05,
+        0xD5F86DA9, 0x19526D37, 0x97DD6AD4, 0x5B776A4A, 0x51B26353, 0x9D1863CD, 0x1397642E, 0xDF3D64B0,
+        0x83D02561, 0x4F7A25FF, 0xC1F5221C, 0x0D5F2282, 0x079A2B9B, 0xCB302B05, 0x45BF2CE6, 0x89152C78,
+        0x50353ED4, 0x9C9F3E4A, 0x121039A9, 0xDEBA3937, 0xD47F302E, 0x18D530B0, 0x965A3753, 0x5AF037CD,
+        0xFF6B144A, 0x33C114D4, 0xBD4E1337, 0x71E413A9, 0x7B211AB0, 0xB78B1A2E, 0x39041DCD, 0xF5AE1D53,
+        0x2C8E0FFF, 0xE0240F61, 0x6EAB0882, 0xA201081C, 0xA8C40105, 0x646E019B, 0xEAE10678, 0x264B06E6
+    }
+};
+#define CRC32_TABLE crc32_table[0]
+#else
+static const uint32_t crc32_table[256] = {
+    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+    0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+    0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+    0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+    0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+    0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+    0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+    0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+    0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+    0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+    0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+    0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+    0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+    0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+    0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+    0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+    0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+    0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+    0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+    0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+    0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+    0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+};
+#define CRC32_TABLE crc32_table
+#endif
+
+void crc32_init(crc32_ctx *ctx) {
+    ctx->state = 0xFFFFFFFFu;
+}
+
+void crc32_update(crc32_ctx *ctx, uint8_t *data, size_t length) {
+    uint32_t crc = ctx->state;
+    size_t index = 0;
+#if defined(__ARM_FEATURE_CRC32)
+    // The CRC32 instructions use the same polynomial and process words in little endian order
+#if defined(__aarch64__)
+    for (; index + 8 <= length; index += 8) {
+        uint64_t word = 0;
+        memcpy(&word, data + index, sizeof(word));
+        crc = __crc32d(crc, word);
+    }
+#endif
+    for (; index + 4 <= length; index += 4) {
+        uint32_t word = 0;
+        memcpy(&word, data + index, sizeof(word));
+        crc = __crc32w(crc, word);
+    }
+    for (; index < length; index++) {
+        crc = __crc32b(crc, data[index]);
+    }
+#else
+#ifdef EPUT_CRC32_SLICE_BY_8
+    for (; index + 8 <= length; index += 8) {
+        uint8_t *b = data + index;
+        uint32_t low = crc ^ ((uint32_t) b[0] | ((uint32_t) b[1] << 8) | ((uint32_t) b[2] << 16) | ((uint32_t) b[3] << 24));
+        crc = crc32_table[7][low & 0xFF]
+            ^ crc32_table[6][(low >> 8) & 0xFF]
+            ^ crc32_table[5][(low >> 16) & 0xFF]
+            ^ crc32_table[4][low >> 24]
+            ^ crc32_table[3][b[4]]
+            ^ crc32_table[2][b[5]]
+            ^ crc32_table[1][b[6]]
+            ^ crc32_table[0][b[7]];
+    }
+#endif
+    for (; index < length; index++) {
+        crc = CRC32_TABLE[(crc ^ data[index]) & 0xFF] ^ (crc >> 8);
+    }
+#endif
+    ctx->state = crc;
+}
+
+void crc32_final(crc32_ctx *ctx, uint8_t *digest) {
+    uint32_to_bytes(ctx->state ^ 0xFFFFFFFFu, digest);
+}
+
+static const uint32_t sha256_k[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+#if defined(__ARM_FEATURE_SHA2)
+
+static void sha256_compress(uint32_t *state, uint8_t *block) {
+    uint32x4_t abcd = vld1q_u32(state);
+    uint32x4_t efgh = vld1q_u32(state + 4);
+    uint32x4_t abcd_saved = abcd;
+    uint32x4_t efgh_saved = efgh;
+    uint32x4_t msg[4];
+    for (size_t i = 0; i < 4; i++) {
+        msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(block + 16 * i)));
+    }
+    // Four rounds per iteration, msg[i % 4] holds the next four words of the message schedule
+    for (size_t i = 0; i < 16; i++) {
+        uint32x4_t wk = vaddq_u32(msg[i & 3], vld1q_u32(sha256_k + 4 * i));
+        uint32x4_t abcd_prev = abcd;
+        abcd = vsha256hq_u32(abcd, efgh, wk);
+        efgh = vsha256h2q_u32(efgh, abcd_prev, wk);
+        if (i < 12) {
+            msg[i & 3] = vsha256su1q_u32(vsha256su0q_u32(msg[i & 3], msg[(i + 1) & 3]), msg[(i + 2) & 3], msg[(i + 3) & 3]);
+        }
+    }
+    vst1q_u32(state, vaddq_u32(abcd, abcd_saved));
+    vst1q_u32(state + 4, vaddq_u32(efgh, efgh_saved));
+}
+
+#else
+
+#define SHA256_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void sha256_compress(uint32_t *state, uint8_t *block) {
+    uint32_t w[64];
+    for (size_t i = 0; i < 16; i++) {
+        w[i] = bytes_to_uint32(block + 4 * i);
+    }
+    for (size_t i = 16; i < 64; i++) {
+        uint32_t s0 = SHA256_ROTR(w[i - 15], 7) ^ SHA256_ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = SHA256_ROTR(w[i - 2], 17) ^ SHA256_ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (size_t i = 0; i < 64; i++) {
+        uint32_t t1 = h + (SHA256_ROTR(e, 6) ^ SHA256_ROTR(e, 11) ^ SHA256_ROTR(e, 25))
+                    + ((e & f) ^ (~e & g)) + sha256_k[i] + w[i];
+        uint32_t t2 = (SHA256_ROTR(a, 2) ^ SHA256_ROTR(a, 13) ^ SHA256_ROTR(a, 22))
+                    + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+#endif
+
+void sha256_init(sha256_ctx *ctx) {
+    static const uint32_t initial_state[8] = {
+        0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+    };
+    memcpy(ctx->state, initial_state, sizeof(initial_state));
+    ctx->length = 0;
+    ctx->block_length = 0;
+}
+
+void sha256_update(sha256_ctx *ctx, uint8_t *data, size_t length) {
+    ctx->length += length;
+    if (ctx->block_length > 0) {
+        size_t missing = SHA256_BLOCK_SIZE - ctx->block_length;
+        size_t copied = length < missing ? length : missing;
+        memcpy(ctx->block + ctx->block_length, data, copied);
+        ctx->block_length += copied;
+        data += copied;
+        length -= copied;
+        if (ctx->block_length < SHA256_BLOCK_SIZE) {
+            return;
+        }
+        sha256_compress(ctx->state, ctx->block);
+        ctx->block_length = 0;
+    }
+    // Full blocks are hashed directly from the input without copying
+    for (; length >= SHA256_BLOCK_SIZE; length -= SHA256_BLOCK_SIZE, data += SHA256_BLOCK_SIZE) {
+        sha256_compress(ctx->state, data);
+    }
+    memcpy(ctx->block, data, length);
+    ctx->block_length = length;
+}
+
+void sha256_final(sha256_ctx *ctx, uint8_t *digest) {
+    uint64_t bit_length = ctx->length * 8;
+    ctx->block[ctx->block_length++] = 0x80;
+    if (ctx->block_length > SHA256_BLOCK_SIZE - 8) {
+        memset(ctx->block + ctx->block_length, 0, SHA256_BLOCK_SIZE - ctx->block_length);
+        sha256_compress(ctx->state, ctx->block);
+        ctx->block_length = 0;
+    }
+    memset(ctx->block + ctx->block_length, 0, SHA256_BLOCK_SIZE - 8 - ctx->block_length);
+    uint64_to_bytes(bit_length, ctx->block + SHA256_BLOCK_SIZE - 8);
+    sha256_compress(ctx->state, ctx->block);
+    for (size_t i = 0; i < 8; i++) {
+        uint32_to_bytes(ctx->state[i], digest + 4 * i);
+    }
+}
+
+int verify_digest(uint8_t *data, size_t length, uint8_t *digest, uint8_t digest_size) {
+    uint8_t computed[SHA256_DIGEST_SIZE];
+    if (digest_size == CRC32_DIGEST_SIZE) {
+        crc32_ctx ctx;
+        crc32_init(&ctx);
+        crc32_update(&ctx, data, length);
+        crc32_final(&ctx, computed);
+    } else if (digest_size == SHA256_DIGEST_SIZE) {
+        sha256_ctx ctx;
+        sha256_init(&ctx);
+        sha256_update(&ctx, data, length);
+        sha256_final(&ctx, computed);
+    } else {
+        return ERR_DIGEST_UNSUPPORTED;
+    }
+    if (memcmp(computed, digest, digest_size) != 0) {
+        return ERR_DIGEST_MISMATCH;
+    }
+    return SUCCESS;
+}
+
+uint32_t get_dictionary_id(uint8_t *dictionary, size_t length) {
+    // Largest block for which the sums can't overflow before the modulo, see zlib
+    const size_t nmax = 5552;
+    uint32_t a = 1;
+    uint32_t b = 0;
+    while (length > 0) {
+        size_t block = length < nmax ? length : nmax;
+        length -= block;
+        while (block-- > 0) {
+            a += *dictionary++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return (b << 16) | a;
+}
+
+int get_zlib_dictionary_id(uint8_t *buf, size_t buf_len, uint32_t *dictionary_id) {
+    if (buf_len < ZLIB_HEADER_SIZE) {
+        return ERR_ZLIB_HEADER_INVALID;
+    }
+    uint8_t cmf = buf[0];
+    uint8_t flg = buf[1];
+    // Deflate with window of at most 32K, header check bits
+    if ((cmf & 0x0F) != 8 || (cmf >> 4) > 7 || ((cmf << 8) | flg) % 31 != 0) {
+        return ERR_ZLIB_HEADER_INVALID;
+    }
+    if ((flg & 0x20) == 0) {
+        *dictionary_id = ZLIB_NO_DICTIONARY;
+        return SUCCESS;
+    }
+    if (buf_len < ZLIB_HEADER_SIZE + ZLIB_DICTIONARY_ID_SIZE) {
+        return ERR_ZLIB_HEADER_INVALID;
+    }
+    *dictionary_id = bytes_to_uint32(buf + ZLIB_HEADER_SIZE);
+    return SUCCESS;
+}
+
+int open_translations(uint8_t *section, size_t length, translation_index *index) {
+    if (length < TRANSLATIONS_HEADER_SIZE || section[0] != TRANSLATIONS_INDEXED) {
+        return ERR_TRANSLATIONS_INVALID;
+    }
+    uint8_t language_count = section[1];
+    if (length - TRANSLATIONS_HEADER_SIZE < (size_t) language_count * 4) {
+        return ERR_TRANSLATIONS_INVALID;
+    }
+    index->section = section;
+    index->length = length;
+    index->language_count = language_count;
+    index->id_count = bytes_to_uint32(section + 2);
+    return SUCCESS;
+}
+
+// Offset of language block in section or 0 if block is out of bounds
+static size_t translation_block_offset(translation_index *index, uint8_t language_index) {
+    size_t offset = bytes_to_uint32(index->section + TRANSLATIONS_HEADER_SIZE + (size_t) language_index * 4);
+    if (offset >= index->length) {
+        return 0;
+    }
+    return offset;
+}
+
+int find_translation_language(translation_index *index, const char *language, uint8_t *language_index) {
+    size_t language_length = strlen(language) + 1;
+    for (uint8_t i = 0; i < index->language_count; i++) {
+        size_t offset = translation_block_offset(index, i);
+        if (offset == 0) {
+            return ERR_TRANSLATIONS_INVALID;
+        }
+        if (index->length - offset >= language_length
+                && memcmp(index->section + offset, language, language_length) == 0) {
+            *language_index = i;
+            return SUCCESS;
+        }
+    }
+    return ERR_TRANSLATION_NOT_FOUND;
+}
+
+int get_translation(translation_index *index, uint8_t language_index, uint32_t id_index, const char **text) {
+    if (language_index >= index->language_count || id_index >= index->id_count) {
+        return ERR_TRANSLATION_NOT_FOUND;
+    }
+    size_t offset = translation_block_offset(index, language_index);
+    if (offset == 0) {
+        return ERR_TRANSLATIONS_INVALID;
+    }
+    uint8_t *block = index->section + offset;
+    size_t block_length = index->length - offset;
+    uint8_t *language_end = memchr(block, 0, block_length);
+    if (language_end == NULL) {
+        return ERR_TRANSLATIONS_INVALID;
+    }
+    size_t entry = (size_t) (language_end - block) + 1 + (size_t) id_index * 2;
+    if (entry >= block_length || block_length - entry < 2) {
+        return ERR_TRANSLATIONS_INVALID;
+    }
+    size_t string_offset = bytes_to_uint16(block + entry);
+    if (string_offset >= block_length || memchr(block + string_offset, 0, block_length - string_offset) == NULL) {
+        return ERR_TRANSLATIONS_INVALID;
+    }
+    *text = (const char *) (block + string_offset);
+    return SUCCESS;
+}
+
+int open_rom_blob(uint8_t *blob, size_t length, rom_blob *rom) {
+    if (length < ROM_BLOB_HEADER_SIZE || blob[0] == 0) {
+        return ERR_ROM_BLOB_INVALID;
+    }
+    uint8_t count = blob[0];
+    uint8_t digest_size = blob[1];
+    size_t descriptor_size = (size_t) digest_size + 8;
+    if ((length - ROM_BLOB_HEADER_SIZE) / descriptor_size < count) {
+        return ERR_ROM_BLOB_INVALID;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t *descriptor = blob + ROM_BLOB_HEADER_SIZE + i * descriptor_size;
+        uint32_t start = bytes_to_uint32(descriptor + digest_size);
+        uint32_t blob_length = bytes_to_uint32(descriptor + digest_size + 4);
+        if (start > length || length - start < blob_length) {
+            return ERR_ROM_BLOB_INVALID;
+        }
+    }
+    rom->blob = blob;
+    rom->length = length;
+    rom->count = count;
+    rom->digest_size = digest_size;
+    return SUCCESS;
+}
+
+int get_rom_blob_entry(rom_blob *rom, uint8_t index, rom_blob_entry *entry) {
+    if (index >= rom->count) {
+        return ERR_ROM_BLOB_NOT_FOUND;
+    }
+    uint8_t *descriptor = rom->blob + ROM_BLOB_HEADER_SIZE + index * ((size_t) rom->digest_size + 8);
+    entry->digest = descriptor;
+    entry->data = rom->blob + bytes_to_uint32(descriptor + rom->digest_size);
+    entry->length = bytes_to_uint32(descriptor + rom->digest_size + 4);
+    return SUCCESS;
+}
+
+int get_rom_blob_data(rom_blob *rom, rom_blob_entry *entry) {
+    return get_rom_blob_entry(rom, ROM_BLOB_DATA_INDEX, entry);
+}
+
+int get_rom_blob_metadata(rom_blob *rom, uint8_t translation_set, rom_blob_entry *entry) {
+    if (translation_set == UINT8_MAX) {
+        return ERR_ROM_BLOB_NOT_FOUND;
+    }
+    return get_rom_blob_entry(rom, translation_set + 1, entry);
+}
+
+int verify_rom_blob_entry(rom_blob *rom, rom_blob_entry *entry) {
+    return verify_digest(entry->data, entry->length, entry->digest, rom->digest_size);
+}
+
+static inline uint64_t rotl64(uint64_t value, unsigned int shift) {
+    return (value << shift) | (value >> (64 - shift));
+}
+
+// Finalizer of MurmurHash3, every input bit affects every output bit
+static inline uint64_t hash_mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+uint64_t hash_bytes(uint8_t *data, size_t length) {
+    const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+    // Four independent lanes so the multiplications of one block can overlap
+    uint64_t lane0 = length;
+    uint64_t lane1 = length ^ multiplier;
+    uint64_t lane2 = ~length;
+    uint64_t lane3 = length * multiplier;
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        uint64_t words[4];
+        memcpy(words, data + i, 32);
+        lane0 = rotl64(lane0 ^ words[0], 29) * multiplier;
+        lane1 = rotl64(lane1 ^ words[1], 29) * multiplier;
+        lane2 = rotl64(lane2 ^ words[2], 29) * multiplier;
+        lane3 = rotl64(lane3 ^ words[3], 29) * multiplier;
+    }
+    uint64_t h = hash_mix(lane0) ^ rotl64(hash_mix(lane1), 16) ^ rotl64(hash_mix(lane2), 32) ^ rotl64(hash_mix(lane3), 48);
+    for (; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, 8);
+        h = rotl64(h ^ word, 29) * multiplier;
+    }
+    if (i < length) {
+        uint64_t word = 0;
+        memcpy(&word, data + i, length - i);
+        h = rotl64(h ^ word, 29) * multiplier;
+    }
+    return hash_mix(h);
+}
+
+#ifdef EPUT_TRACE
+static trace_stat trace_stats[EPUT_TRACE_POINT_COUNT];
+
+void init_trace(void) {
+#ifdef EPUT_TRACE_DWT
+    // Set TRCENA in DEMCR, then CYCCNTENA in DWT_CTRL
+    *(volatile uint32_t *) 0xE000EDFCu |= 0x01000000u;
+    // Unlock DWT on Cortex-M7, write is ignored on cores without lock access register
+    *(volatile uint32_t *) 0xE0001FB0u = 0xC5ACCE55u;
+    *(volatile uint32_t *) 0xE0001004u = 0;
+    *(volatile uint32_t *) 0xE0001000u |= 0x00000001u;
+#endif
+    reset_trace_stats();
+}
+
+trace_ticks get_trace_ticks(void) {
+#if defined(EPUT_TRACE_DWT)
+    return *(volatile uint32_t *) 0xE0001004u;
+#elif defined(EPUT_TRACE_TSC)
+    return __rdtsc();
+#else
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+#endif
+}
+
+void record_trace(uint8_t point, trace_ticks ticks, size_t bytes) {
+    if (point >= EPUT_TRACE_POINT_COUNT) {
+        return;
+    }
+    trace_stat *stat = trace_stats + point;
+    stat->calls += 1;
+    stat->ticks += ticks;
+    stat->bytes += bytes;
+    if (ticks > stat->max_ticks) {
+        stat->max_ticks = ticks;
+    }
+}
+
+int get_trace_stat(uint8_t point, trace_stat *stat) {
+    if (point >= EPUT_TRACE_POINT_COUNT) {
+        return ERR_TRACE_POINT_INVALID;
+    }
+    *stat = trace_stats[point];
+    return SUCCESS;
+}
+
+void reset_trace_stats(void) {
+    memset(trace_stats, 0, sizeof(trace_stats));
+}
+#endif
@@ -0,0 +1,37 @@
+// Wraps the generated library BENCH_LIB_SOURCE, compiled once per library.
+// Symbols of the library are prefixed with BENCH_PREFIX, so multiple libraries can be linked into one binary.
+// The prefix includes the trailing underscore, as the plain library name is the header's include guard.
+#include "bench_lib.h"
+
+#define BENCH_CAT2(a, b) a##b
+#define BENCH_CAT(a, b) BENCH_CAT2(a, b)
+
+#define parse_nfc BENCH_CAT(BENCH_PREFIX, parse_nfc)
+#define parse_ndef BENCH_CAT(BENCH_PREFIX, parse_ndef)
+#define parse_payload BENCH_CAT(BENCH_PREFIX, parse_payload)
+#define generate_payload BENCH_CAT(BENCH_PREFIX, generate_payload)
+
+#include BENCH_LIB_SOURCE
+
+#define BENCH_CONFIG BENCH_CAT(BENCH_PREFIX, config)
+
+static int bench_parse_nfc(uint8_t *buf, size_t buf_len, void *config) {
+    return parse_nfc(buf, buf_len, (BENCH_CONFIG *) config);
+}
+
+static int bench_parse_payload(uint8_t *buf, size_t buf_len, void *config) {
+    return parse_payload(buf, buf_len, (BENCH_CONFIG *) config);
+}
+
+static int bench_generate_payload(uint8_t *buf, void *config) {
+    return generate_payload(buf, (BENCH_CONFIG *) config);
+}
+
+const bench_lib BENCH_CAT(BENCH_PREFIX, bench) = {
+    BENCH_NAME,
+    DATA_PAYLOAD_LENGTH,
+    sizeof(BENCH_CONFIG),
+    bench_parse_nfc,
+    bench_parse_payload,
+    bench_generate_payload
+};
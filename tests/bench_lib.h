@@ -0,0 +1,21 @@
+#ifndef BENCH_LIB_H
+#define BENCH_LIB_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Entry points of a generated library, see bench_lib.c
+typedef struct {
+    const char *name;
+    size_t payload_length;
+    size_t config_size;
+    int (*parse_nfc)(uint8_t *buf, size_t buf_len, void *config);
+    int (*parse_payload)(uint8_t *buf, size_t buf_len, void *config);
+    int (*generate_payload)(uint8_t *buf, void *config);
+} bench_lib;
+
+extern const bench_lib thermostat_bench;
+extern const bench_lib all_types_bench;
+extern const bench_lib logger_bench;
+
+#endif
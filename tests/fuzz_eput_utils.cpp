@@ -0,0 +1,151 @@
+// Fuzzing harness for the TLV and NDEF record parsers.
+//
+// libFuzzer: make fuzz_eput_utils_libfuzzer.exe && ./fuzz_eput_utils_libfuzzer.exe fuzz_corpus/
+// AFL: build FUZZ_STANDALONE with afl-clang-fast++ and run it with `@@` or with inputs on stdin
+// Without a fuzzer: make fuzz_eput_utils.exe && ./fuzz_eput_utils.exe fuzz_corpus/
+// runs the corpus or single crash files with address and undefined behavior sanitizers.
+#include "fuzz_eput_utils.h"
+#include <cstdio>
+#include <cstdlib>
+#include <dirent.h>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+extern "C" {
+    #include "../src/eputgen/c/eput_utils.h"
+}
+
+// Number of records get_all_records may return
+static const size_t ARENA_CAPACITY = 8;
+
+static void check_range(uint8_t *start, size_t length, uint8_t *buf, size_t buf_len) {
+    if (length > 0 && (start < buf || length > buf_len || start > buf + buf_len - length)) {
+        std::fprintf(stderr, "Parsed range of %zu bytes outside of buffer\n", length);
+        std::abort();
+    }
+}
+
+static size_t check_record(ndef_record *record, uint8_t *buf, size_t buf_len) {
+    check_range(record->type, record->type_length, buf, buf_len);
+    check_range(record->id, record->id_length, buf, buf_len);
+    check_range(record->payload, record->payload_length, buf, buf_len);
+    return record->type_length + record->id_length + record->payload_length;
+}
+
+static size_t parse_records(uint8_t *buf, size_t len) {
+    size_t sum = 0;
+    ndef_record data = {};
+    ndef_record meta = {};
+    int ret = get_record(buf, len, &data);
+    if (ret > 0) {
+        if ((size_t) ret > len) {
+            std::abort();
+        }
+        sum += check_record(&data, buf, len);
+    }
+    if (get_records(buf, len, &meta, &data) == SUCCESS) {
+        sum += check_record(&data, buf, len) + check_record(&meta, buf, len);
+    }
+    ndef_record arena[ARENA_CAPACITY];
+    size_t count = 0;
+    get_all_records(buf, len, NULL, arena, ARENA_CAPACITY, &count);
+    for (size_t i = 0; i < count; i++) {
+        sum += check_record(&arena[i], buf, len);
+    }
+    return sum;
+}
+
+size_t parse_ndef_input(uint8_t *buf, size_t len) {
+    size_t sum = 0;
+    tlv_cursor cursor = {};
+    tlv_block tlv = {};
+    while (get_next_tlv(buf, len, &cursor, &tlv) == SUCCESS) {
+        if (tlv.value_offset > len) {
+            std::abort();
+        }
+        sum += tlv.length;
+    }
+
+    size_t offset = 0;
+    uint16_t ndef_length = get_ndef_tlv_offset(buf, len, &offset);
+    // Value field may exceed the buffer, like parse_nfc only parse complete ones
+    if (ndef_length > 0 && offset <= len && ndef_length <= len - offset) {
+        sum += parse_records(buf + offset, ndef_length);
+    }
+    // Inputs without TLVs are parsed as NDEF message
+    sum += parse_records(buf, len);
+
+    // Feed the dump in pieces like a reader receiving it from the tag
+    std::vector<uint8_t> stream_buf(len);
+    ndef_stream stream;
+    ndef_stream_init(&stream, stream_buf.data(), stream_buf.size());
+    size_t piece = len > 0 ? (size_t) (buf[0] % 16) + 1 : 1;
+    ndef_record data = {};
+    for (size_t fed = 0; fed < len; fed += piece) {
+        size_t piece_len = len - fed < piece ? len - fed : piece;
+        int ret = ndef_stream_feed(&stream, buf + fed, piece_len, &data);
+        if (ret == SUCCESS) {
+            sum += check_record(&data, stream_buf.data(), stream_buf.size());
+            break;
+        } else if (ret != NDEF_STREAM_NEED_MORE) {
+            break;
+        }
+    }
+    return sum;
+}
+
+std::vector<std::vector<uint8_t>> load_fuzz_corpus(const std::string &path) {
+    std::vector<std::vector<uint8_t>> corpus;
+    DIR *dir = opendir(path.c_str());
+    if (dir == NULL) {
+        return corpus;
+    }
+    for (struct dirent *entry = readdir(dir); entry != NULL; entry = readdir(dir)) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        std::ifstream file(path + "/" + entry->d_name, std::ios::binary);
+        corpus.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    closedir(dir);
+    return corpus;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    // Parsers take mutable buffers, an exactly sized copy also lets the sanitizer catch reads past the end
+    std::vector<uint8_t> buf(data, data + size);
+    parse_ndef_input(buf.data(), buf.size());
+    return 0;
+}
+
+#ifdef FUZZ_STANDALONE
+static void run_input(std::vector<uint8_t> &input) {
+    LLVMFuzzerTestOneInput(input.data(), input.size());
+}
+
+int main(int argc, char **argv) {
+    size_t count = 0;
+    if (argc < 2) {
+        std::vector<uint8_t> input(
+            (std::istreambuf_iterator<char>(std::cin.rdbuf())),
+            std::istreambuf_iterator<char>());
+        run_input(input);
+        count++;
+    }
+    for (int i = 1; i < argc; i++) {
+        std::vector<std::vector<uint8_t>> inputs = load_fuzz_corpus(argv[i]);
+        if (inputs.empty()) {
+            // Not a folder, e.g. a single crash file
+            std::ifstream file(argv[i], std::ios::binary);
+            inputs.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+        for (std::vector<uint8_t> &input : inputs) {
+            run_input(input);
+            count++;
+        }
+    }
+    std::printf("Ran %zu inputs\n", count);
+    return 0;
+}
+#endif
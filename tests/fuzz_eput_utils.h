@@ -0,0 +1,22 @@
+#ifndef FUZZ_EPUT_UTILS_H
+#define FUZZ_EPUT_UTILS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Run the NFC memory dump in `buf` through the TLV and NDEF record parsers, aborting if a parser
+ * returns a record outside of `buf`.
+ *
+ * @return sum of the lengths of the found records, keeps benchmarks from optimizing parsing away
+ */
+size_t parse_ndef_input(uint8_t *buf, size_t len);
+
+/**
+ * @brief Read all files in a folder, e.g. the fuzzing corpus.
+ */
+std::vector<std::vector<uint8_t>> load_fuzz_corpus(const std::string &path);
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef NDEF_TLV_CASES_H
+#define NDEF_TLV_CASES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// NFC memory dumps scanned by both the C and the C++ utilities, which have to agree on the NDEF message found
+struct ndef_tlv_case {
+    const char *name;
+    std::vector<std::uint8_t> memory;
+    // Position of the NDEF message in memory, length 0 if there is none
+    std::size_t offset;
+    std::size_t length;
+};
+
+inline std::vector<ndef_tlv_case> ndef_tlv_cases() {
+    std::vector<ndef_tlv_case> cases = {
+        {"single", {0x03, 0x02, 0xD0, 0x00}, 2, 2},
+        {"lock_and_long_length", {0x00, 0x01, 0x03, 0xA0, 0x0C, 0x34, 0x03, 0xFF, 0x00, 0x02, 0xAA, 0xBB, 0xFE}, 10, 2},
+        {"empty_first", {0x03, 0x00, 0x03, 0x01, 0xAA}, 0, 0},
+        {"terminated", {0x00, 0xFE, 0x03, 0x01, 0xAA}, 0, 0},
+        {"value_truncated", {0x03, 0x05, 0xAA}, 0, 0},
+        {"length_truncated", {0x00, 0x03, 0xFF, 0x00}, 0, 0},
+        {"no_tlv", {}, 0, 0},
+    };
+    // Reserved length 0xFFFF ends the scan even if the following NDEF TLV is inside memory
+    std::vector<std::uint8_t> reserved = {0x01, 0xFF, 0xFF, 0xFF};
+    reserved.insert(reserved.end(), 0xFFFF, 0x00);
+    reserved.insert(reserved.end(), {0x03, 0x01, 0xAA});
+    cases.push_back({"reserved_length", reserved, 0, 0});
+    return cases;
+}
+
+#endif
@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+#include <limits>
+
+// Library generated from descriptors/all_types.yaml for the benchmarks, with --fixp-kernels
+extern "C" {
+    #include "bench_gen/eput_all_types.h"
+}
+
+TEST(eput_lib, fixp_kernels) {
+    // temp is fixp32 with scale 2
+    fixp32 temp = {2150, 2};
+    fixp32 factor = {200, 2};
+    ASSERT_EQ(4300, multiply_temp(temp, factor).unscaled);
+    ASSERT_EQ(2, multiply_temp(temp, factor).scale);
+    fixp32 small = {-150, 2};
+    // -1.50 * 0.01 = -0.015 rounds half away from zero to -0.02
+    ASSERT_EQ(-2, multiply_temp(small, fixp32{1, 2}).unscaled);
+    fixp32 max = {std::numeric_limits<int32_t>::max(), 2};
+    ASSERT_EQ(std::numeric_limits<int32_t>::max(), multiply_temp(max, fixp32{10000, 2}).unscaled);
+    ASSERT_EQ(std::numeric_limits<int32_t>::max(), add_temp(max, factor).unscaled);
+    ASSERT_EQ(2150, rescale_temp(fixp32{215, 1}).unscaled);
+    ASSERT_EQ(1, compare_temp(temp, factor));
+    ASSERT_EQ(22, round_temp(temp));
+    ASSERT_EQ(-22, round_temp(fixp32{-2150, 2}));
+    ASSERT_EQ(21, round_temp(fixp32{2149, 2}));
+
+    // energy is fixp64 with scale 3
+    fixp64 energy = {1500, 3};
+    ASSERT_EQ(-3750, multiply_energy(energy, fixp64{-2500, 3}).unscaled);
+    ASSERT_EQ(std::numeric_limits<int64_t>::max(), multiply_energy(fixp64{std::numeric_limits<int64_t>::max(), 3}, fixp64{2000, 3}).unscaled);
+    ASSERT_EQ(2, round_energy(energy));
+    ASSERT_EQ(-1, round_energy(fixp64{-1499, 3}));
+}
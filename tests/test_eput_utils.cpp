@@ -2,9 +2,13 @@
 #include <utility>
 #include <vector>
 #include <algorithm>
+#include <string>
+#include <cstring>
 
 #include <limits>
 
+#include "ndef_tlv_cases.h"
+
 extern "C" {
     #include "../src/eputgen/c/eput_utils.h"
 }
@@ -415,14 +419,701 @@ TEST(eput_utils, other_conversion) {
     test_fixp64({INT64_MAX, INT32_MAX});
 }
 
+TEST(eput_utils, byte_order) {
+    uint8_t bytes[8] = {0};
+
+    uint16_to_bytes(0x0102, bytes);
+    ASSERT_EQ(0x01, bytes[0]);
+    ASSERT_EQ(0x02, bytes[1]);
+
+    uint32_to_bytes(0x01020304, bytes);
+    ASSERT_EQ(0x01, bytes[0]);
+    ASSERT_EQ(0x02, bytes[1]);
+    ASSERT_EQ(0x03, bytes[2]);
+    ASSERT_EQ(0x04, bytes[3]);
+
+    uint64_to_bytes(0x0102030405060708, bytes);
+    for (uint8_t i = 0; i < 8; i++) {
+        ASSERT_EQ(i + 1, bytes[i]);
+    }
+    ASSERT_EQ(0x0102030405060708u, bytes_to_uint64(bytes));
+    ASSERT_EQ(0x01020304u, bytes_to_uint32(bytes));
+    ASSERT_EQ(0x0102u, bytes_to_uint16(bytes));
+
+    int16_to_bytes(-2, bytes);
+    ASSERT_EQ(0xFF, bytes[0]);
+    ASSERT_EQ(0xFE, bytes[1]);
+
+    float_to_bytes(1.0f, bytes);
+    ASSERT_EQ(0x3F, bytes[0]);
+    ASSERT_EQ(0x80, bytes[1]);
+    ASSERT_EQ(0x00, bytes[2]);
+    ASSERT_EQ(0x00, bytes[3]);
+
+    double_to_bytes(-2.0, bytes);
+    ASSERT_EQ(0xC0, bytes[0]);
+    for (uint8_t i = 1; i < 8; i++) {
+        ASSERT_EQ(0x00, bytes[i]);
+    }
+}
+
+// Compares bulk conversion with the scalar converters, contiguous and with a gap after each value
+template <typename T>
+void test_array(void (*bulk_read)(uint8_t *, T *, size_t, size_t), T (*read)(uint8_t *),
+                void (*bulk_write)(T *, uint8_t *, size_t, size_t)) {
+    struct entry {
+        T val;
+        uint8_t gap;
+    };
+    const size_t max_count = 37;
+    std::vector<uint8_t> bytes(max_count * sizeof(T));
+    for (size_t i = 0; i < bytes.size(); i++) {
+        bytes[i] = (uint8_t) (i * 7 + 1);
+    }
+    for (size_t count = 0; count <= max_count; count++) {
+        std::vector<T> vals(count + 1);
+        std::vector<entry> entries(count + 1);
+        bulk_read(bytes.data(), vals.data(), count, sizeof(T));
+        bulk_read(bytes.data(), &entries[0].val, count, sizeof(entry));
+        for (size_t i = 0; i < count; i++) {
+            T expected = read(bytes.data() + i * sizeof(T));
+            ASSERT_EQ(0, memcmp(&expected, &vals[i], sizeof(T)));
+            ASSERT_EQ(0, memcmp(&expected, &entries[i].val, sizeof(T)));
+        }
+        std::vector<uint8_t> written(count * sizeof(T) + 1, 0xAA);
+        bulk_write(vals.data(), written.data(), count, sizeof(T));
+        ASSERT_TRUE(std::equal(written.begin(), written.end() - 1, bytes.begin()));
+        ASSERT_EQ(0xAA, written.back());
+        std::fill(written.begin(), written.end(), 0xAA);
+        bulk_write(&entries[0].val, written.data(), count, sizeof(entry));
+        ASSERT_TRUE(std::equal(written.begin(), written.end() - 1, bytes.begin()));
+    }
+}
+
+TEST(eput_utils, array_conversion) {
+    test_array<uint8_t>(bytes_to_uint8_array, bytes_to_uint8, uint8_array_to_bytes);
+    test_array<uint16_t>(bytes_to_uint16_array, bytes_to_uint16, uint16_array_to_bytes);
+    test_array<uint32_t>(bytes_to_uint32_array, bytes_to_uint32, uint32_array_to_bytes);
+    test_array<uint64_t>(bytes_to_uint64_array, bytes_to_uint64, uint64_array_to_bytes);
+    test_array<int8_t>(bytes_to_int8_array, bytes_to_int8, int8_array_to_bytes);
+    test_array<int16_t>(bytes_to_int16_array, bytes_to_int16, int16_array_to_bytes);
+    test_array<int32_t>(bytes_to_int32_array, bytes_to_int32, int32_array_to_bytes);
+    test_array<int64_t>(bytes_to_int64_array, bytes_to_int64, int64_array_to_bytes);
+    test_array<float>(bytes_to_float_array, bytes_to_float, float_array_to_bytes);
+    test_array<double>(bytes_to_double_array, bytes_to_double, double_array_to_bytes);
+}
+
 TEST(eput_utils, get_ndef_tlv_offset) {
-    FAIL() << "Not implemented";
+    for (size_t padding = 0; padding < 70; padding++) {
+        std::vector<uint8_t> buf(padding, TLV_TYPE_NULL);
+        std::vector<uint8_t> lock_tlv = {0x01, 0x03, 0xA0, 0x0C, 0x34};
+        std::vector<uint8_t> ndef_tlv = {TLV_TYPE_NDEF, 0x04, 0xD1, 0x01, 0x00, 0x54, TLV_TYPE_TERMINATOR};
+        buf.insert(buf.end(), lock_tlv.begin(), lock_tlv.end());
+        buf.insert(buf.end(), padding % 5, TLV_TYPE_NULL);
+        size_t ndef_start = buf.size();
+        buf.insert(buf.end(), ndef_tlv.begin(), ndef_tlv.end());
+        size_t offset = 0;
+        ASSERT_EQ(4, get_ndef_tlv_offset(buf.data(), buf.size(), &offset));
+        ASSERT_EQ(ndef_start + 2, offset);
+    }
+
+    std::vector<uint8_t> long_tlv(300, 0x00);
+    long_tlv[20] = TLV_TYPE_NDEF;
+    long_tlv[21] = 0xFF;
+    long_tlv[22] = 0x01;
+    long_tlv[23] = 0x02;
+    size_t offset = 0;
+    ASSERT_EQ(0x0102, get_ndef_tlv_offset(long_tlv.data(), long_tlv.size(), &offset));
+    ASSERT_EQ(24u, offset);
+    // Value field may exceed buffer, caller has to check
+    ASSERT_EQ(0x0102, get_ndef_tlv_offset(long_tlv.data(), 24, &offset));
+    ASSERT_EQ(0, get_ndef_tlv_offset(long_tlv.data(), 23, &offset));
+    long_tlv[22] = 0xFF;
+    long_tlv[23] = 0xFF;
+    ASSERT_EQ(0, get_ndef_tlv_offset(long_tlv.data(), long_tlv.size(), &offset));
+
+    uint8_t terminated[] = {0x00, TLV_TYPE_TERMINATOR, TLV_TYPE_NDEF, 0x01, 0x00};
+    ASSERT_EQ(0, get_ndef_tlv_offset(terminated, sizeof(terminated), &offset));
+    uint8_t empty[64] = {0};
+    ASSERT_EQ(0, get_ndef_tlv_offset(empty, sizeof(empty), &offset));
+    uint8_t truncated[] = {0x00, 0x00, TLV_TYPE_NDEF};
+    ASSERT_EQ(0, get_ndef_tlv_offset(truncated, sizeof(truncated), &offset));
+}
+
+// Same cases as find_ndef_message in test_eput_utils_cpp.cpp, checked like parse_nfc does
+TEST(eput_utils, ndef_tlv_cases) {
+    for (ndef_tlv_case &test_case : ndef_tlv_cases()) {
+        SCOPED_TRACE(test_case.name);
+        size_t offset = 0;
+        size_t length = get_ndef_tlv_offset(test_case.memory.data(), test_case.memory.size(), &offset);
+        if (length == 0 || offset + length > test_case.memory.size()) {
+            ASSERT_EQ(0u, test_case.length);
+        } else {
+            ASSERT_EQ(test_case.offset, offset);
+            ASSERT_EQ(test_case.length, length);
+        }
+    }
+}
+
+TEST(eput_utils, get_next_tlv) {
+    uint8_t buf[] = {
+        0x00, 0x01, 0x03, 0xA0, 0x0C, 0x34,
+        0x00, 0x00, TLV_TYPE_NDEF, 0x02, 0xAA, 0xBB,
+        TLV_TYPE_NDEF, 0x00,
+        TLV_TYPE_TERMINATOR, 0x03, 0x01};
+    tlv_cursor cursor = {0};
+    tlv_block tlv = {0, 0, 0};
+    ASSERT_EQ(SUCCESS, get_next_tlv(buf, sizeof(buf), &cursor, &tlv));
+    ASSERT_EQ(0x01, tlv.type);
+    ASSERT_EQ(3, tlv.length);
+    ASSERT_EQ(3u, tlv.value_offset);
+    ASSERT_EQ(SUCCESS, get_next_tlv(buf, sizeof(buf), &cursor, &tlv));
+    ASSERT_EQ(TLV_TYPE_NDEF, tlv.type);
+    ASSERT_EQ(2, tlv.length);
+    ASSERT_EQ(10u, tlv.value_offset);
+    ASSERT_EQ(SUCCESS, find_tlv(buf, sizeof(buf), &cursor, TLV_TYPE_NDEF, &tlv));
+    ASSERT_EQ(0, tlv.length);
+    ASSERT_EQ(14u, tlv.value_offset);
+    ASSERT_EQ(ERR_TLV_END, get_next_tlv(buf, sizeof(buf), &cursor, &tlv));
+    ASSERT_EQ(ERR_TLV_END, get_next_tlv(buf, sizeof(buf), &cursor, &tlv));
+
+    cursor.index = 0;
+    ASSERT_EQ(ERR_TLV_END, find_tlv(buf, sizeof(buf), &cursor, 0x02, &tlv));
+    cursor.index = 0;
+    ASSERT_EQ(ERR_TLV_TRUNCATED, get_next_tlv(buf, 2, &cursor, &tlv));
+    uint8_t reserved[] = {TLV_TYPE_NDEF, 0xFF, 0xFF, 0xFF};
+    cursor.index = 0;
+    ASSERT_EQ(ERR_TLV_INVALID, get_next_tlv(reserved, sizeof(reserved), &cursor, &tlv));
+}
+
+std::vector<uint8_t> make_record(uint8_t flags, std::string type, std::vector<uint8_t> payload) {
+    std::vector<uint8_t> rec(3 + type.size() + payload.size());
+    rec[0] = flags | TNF_URI | 0x10;
+    rec[1] = type.size();
+    rec[2] = payload.size();
+    std::copy(type.begin(), type.end(), rec.begin() + 3);
+    std::copy(payload.begin(), payload.end(), rec.begin() + 3 + type.size());
+    return rec;
+}
+
+std::vector<uint8_t> make_dump() {
+    std::vector<uint8_t> data_rec = make_record(0x80, RECORD_TYPE_SCHEME "/data", {1, 2, 3, 4, 5});
+    std::vector<uint8_t> meta_rec = make_record(0x40, RECORD_TYPE_SCHEME "/meta", std::vector<uint8_t>(40, 0xAB));
+    std::vector<uint8_t> dump = {0x01, 0x03, 0xA0, 0x0C, 0x34, 0x00, 0x00, TLV_TYPE_NDEF};
+    dump.push_back((uint8_t) (data_rec.size() + meta_rec.size()));
+    dump.insert(dump.end(), data_rec.begin(), data_rec.end());
+    dump.insert(dump.end(), meta_rec.begin(), meta_rec.end());
+    dump.push_back(TLV_TYPE_TERMINATOR);
+    return dump;
+}
+
+TEST(eput_utils, ndef_stream) {
+    std::vector<uint8_t> dump = make_dump();
+    size_t data_rec_end = 9 + 3 + sizeof(RECORD_TYPE_SCHEME "/data") - 1 + 5;
+    for (size_t page_size : {1, 4, 16}) {
+        std::vector<uint8_t> buf(dump.size());
+        ndef_stream stream;
+        ndef_record rec = {};
+        ndef_stream_init(&stream, buf.data(), buf.size());
+        size_t fed = 0;
+        int ret = NDEF_STREAM_NEED_MORE;
+        while (ret == NDEF_STREAM_NEED_MORE && fed < dump.size()) {
+            size_t len = std::min(page_size, dump.size() - fed);
+            ret = ndef_stream_feed(&stream, dump.data() + fed, len, &rec);
+            fed += len;
+        }
+        ASSERT_EQ(SUCCESS, ret);
+        // parsing has to finish before the meta data record is read
+        ASSERT_LT(fed, data_rec_end + page_size);
+        ASSERT_EQ(5u, rec.payload_length);
+        ASSERT_EQ(5, rec.payload[4]);
+        ASSERT_EQ(SUCCESS, ndef_stream_feed(&stream, dump.data(), 0, &rec));
+    }
+
+    // reading directly into the stream buffer
+    std::vector<uint8_t> buf(dump.size());
+    ndef_stream stream;
+    ndef_record rec = {};
+    ndef_stream_init(&stream, buf.data(), buf.size());
+    std::copy(dump.begin(), dump.begin() + 8, buf.begin());
+    ASSERT_EQ(NDEF_STREAM_NEED_MORE, ndef_stream_feed(&stream, buf.data(), 8, &rec));
+    std::copy(dump.begin() + 8, dump.end(), buf.begin() + 8);
+    ASSERT_EQ(SUCCESS, ndef_stream_feed(&stream, buf.data() + 8, dump.size() - 8, &rec));
+    ASSERT_EQ(3, rec.payload[2]);
+
+    ndef_stream_init(&stream, buf.data(), 4);
+    ASSERT_EQ(ERR_STREAM_BUF_FULL, ndef_stream_feed(&stream, dump.data(), 5, &rec));
+
+    uint8_t terminated[] = {0x00, TLV_TYPE_TERMINATOR, TLV_TYPE_NDEF, 0x00};
+    ndef_stream_init(&stream, buf.data(), buf.size());
+    ASSERT_EQ(ERR_NO_NDEF_TLV, ndef_stream_feed(&stream, terminated, sizeof(terminated), &rec));
+
+    // NDEF TLV ends before the record is complete
+    std::vector<uint8_t> short_tlv(dump.begin(), dump.begin() + 16);
+    short_tlv[8] = 5;
+    ndef_stream_init(&stream, buf.data(), buf.size());
+    ASSERT_EQ(ERR_REC_BUF_TRUNCATED, ndef_stream_feed(&stream, short_tlv.data(), short_tlv.size(), &rec));
+
+    std::vector<uint8_t> wrong_type = make_dump();
+    wrong_type[12] = 'x';
+    ndef_stream_init(&stream, buf.data(), buf.size());
+    ASSERT_EQ(ERR_REC_WRONG_TYPE, ndef_stream_feed(&stream, wrong_type.data(), wrong_type.size(), &rec));
 }
 
 TEST(eput_utils, get_record) {
-    FAIL() << "Not implemented";
+    std::vector<uint8_t> buf = {0x83 | 0x10 | 0x08, 0x02, 0x03, 0x01, 'a', 'b', 'i', 0x07, 0x08, 0x09};
+    ndef_record rec = {};
+    ASSERT_EQ((int) buf.size(), get_record(buf.data(), buf.size(), &rec));
+    ASSERT_EQ(TNF_URI, rec.tnf);
+    ASSERT_EQ(2, rec.type_length);
+    ASSERT_EQ('a', rec.type[0]);
+    ASSERT_EQ(1, rec.id_length);
+    ASSERT_EQ('i', rec.id[0]);
+    ASSERT_EQ(3u, rec.payload_length);
+    ASSERT_EQ(0x09, rec.payload[2]);
+    for (size_t len = 0; len < buf.size(); len++) {
+        ASSERT_EQ(ERR_REC_BUF_TRUNCATED, get_record(buf.data(), len, &rec));
+    }
+
+    std::vector<uint8_t> long_rec = {0x03, 0x01, 0x00, 0x00, 0x01, 0x00, 'a'};
+    long_rec.resize(long_rec.size() + 0x100, 0x55);
+    ASSERT_EQ((int) long_rec.size(), get_record(long_rec.data(), long_rec.size(), &rec));
+    ASSERT_EQ(0x100u, rec.payload_length);
+    ASSERT_EQ(ERR_REC_BUF_TRUNCATED, get_record(long_rec.data(), 5, &rec));
+
+    // Payload length close to 2^32 must not wrap around in the length check
+    std::vector<uint8_t> huge_rec = {0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFA, 'a', 0x00};
+    ASSERT_EQ(ERR_REC_BUF_TRUNCATED, get_record(huge_rec.data(), huge_rec.size(), &rec));
 }
 
 TEST(eput_utils, get_records) {
-    FAIL() << "Not implemented";
+    std::vector<uint8_t> dump = make_dump();
+    std::vector<uint8_t> msg(dump.begin() + 9, dump.end() - 1);
+    ndef_record meta = {};
+    ndef_record data = {};
+    ASSERT_EQ(SUCCESS, get_records(msg.data(), msg.size(), &meta, &data));
+    ASSERT_EQ(5u, data.payload_length);
+    ASSERT_EQ(40u, meta.payload_length);
+    ASSERT_EQ(0xAB, meta.payload[39]);
+
+    size_t data_len = 3 + RECORD_TYPE_SCHEME_LENGTH + 5 + 5;
+    ASSERT_EQ((int) data_len, get_data_record(msg.data(), msg.size(), &data));
+    ASSERT_EQ(1, data.payload[0]);
+    // meta data record is not needed
+    ASSERT_EQ((int) data_len, get_data_record(msg.data(), data_len, &data));
+    ASSERT_EQ(ERR_REC_BUF_TRUNCATED, get_records(msg.data(), data_len, &meta, &data));
+
+    std::vector<uint8_t> wrong_meta = msg;
+    wrong_meta[data_len + 3] = 'x';
+    ASSERT_EQ(ERR_REC_WRONG_TYPE, get_records(wrong_meta.data(), wrong_meta.size(), &meta, &data));
+    ASSERT_EQ((int) data_len, get_data_record(wrong_meta.data(), wrong_meta.size(), &data));
+    std::vector<uint8_t> wrong_tnf = msg;
+    wrong_tnf[0] = 0x91;
+    ASSERT_EQ(ERR_REC_WRONG_TYPE, get_data_record(wrong_tnf.data(), wrong_tnf.size(), &data));
+    std::vector<uint8_t> short_type = msg;
+    short_type[1] = RECORD_TYPE_SCHEME_LENGTH - 1;
+    ASSERT_EQ(ERR_REC_WRONG_TYPE, get_data_record(short_type.data(), short_type.size(), &data));
+}
+
+TEST(eput_utils, get_all_records) {
+    std::vector<uint8_t> msg;
+    for (std::vector<uint8_t> rec : {
+            make_record(0x80, RECORD_TYPE_SCHEME "/data", {1, 2, 3}),
+            make_record(0x00, RECORD_TYPE_SCHEME "/meta", {4}),
+            make_record(0x00, "vendor", {5, 6}),
+            make_record(0x00, RECORD_TYPE_SCHEME "/sig", {7}),
+            make_record(0x40, "Sp", {8})}) {
+        msg.insert(msg.end(), rec.begin(), rec.end());
+    }
+    // well-known TNF for the last record
+    size_t last = msg.size() - 6;
+    msg[last] = (msg[last] & ~0x07) | 0x01;
+    // bytes after the message end are ignored
+    msg.push_back(0xFF);
+
+    ndef_record arena[5];
+    size_t count = 0;
+    ASSERT_EQ(SUCCESS, get_all_records(msg.data(), msg.size(), NULL, arena, 5, &count));
+    ASSERT_EQ(5u, count);
+    ASSERT_EQ(6, arena[2].payload[1]);
+    ASSERT_EQ(0x01, arena[4].tnf);
+
+    ndef_record_filter eput_only = {TNF_URI, (const uint8_t *) RECORD_TYPE_SCHEME, RECORD_TYPE_SCHEME_LENGTH};
+    ASSERT_EQ(SUCCESS, get_all_records(msg.data(), msg.size(), &eput_only, arena, 5, &count));
+    ASSERT_EQ(3u, count);
+    ASSERT_EQ(7, arena[2].payload[0]);
+    ndef_record_filter well_known = {0x01, NULL, 0};
+    ASSERT_EQ(SUCCESS, get_all_records(msg.data(), msg.size(), &well_known, arena, 5, &count));
+    ASSERT_EQ(1u, count);
+    ASSERT_EQ(8, arena[0].payload[0]);
+    ndef_record_filter vendor = {TNF_ANY, (const uint8_t *) "vendorx", 7};
+    ASSERT_EQ(SUCCESS, get_all_records(msg.data(), msg.size(), &vendor, arena, 5, &count));
+    ASSERT_EQ(0u, count);
+
+    ASSERT_EQ(ERR_REC_ARENA_FULL, get_all_records(msg.data(), msg.size(), NULL, arena, 2, &count));
+    ASSERT_EQ(2u, count);
+    ASSERT_EQ(4, arena[1].payload[0]);
+    ASSERT_EQ(ERR_REC_BUF_TRUNCATED, get_all_records(msg.data(), msg.size() - 2, NULL, arena, 5, &count));
+
+    // iteration continues from the cursor and ends with the message
+    ndef_record_cursor cursor = {};
+    ndef_record rec;
+    ASSERT_EQ(SUCCESS, get_next_record(msg.data(), msg.size(), &cursor, &eput_only, &rec));
+    ASSERT_EQ(SUCCESS, get_next_record(msg.data(), msg.size(), &cursor, &eput_only, &rec));
+    ASSERT_EQ(SUCCESS, get_next_record(msg.data(), msg.size(), &cursor, &eput_only, &rec));
+    ASSERT_EQ(ERR_REC_END, get_next_record(msg.data(), msg.size(), &cursor, &eput_only, &rec));
+    ASSERT_EQ(msg.size() - 1, cursor.index);
+    ASSERT_EQ(ERR_REC_END, get_next_record(msg.data(), msg.size(), &cursor, NULL, &rec));
+}
+
+TEST(eput_utils, add_byte_range) {
+    byte_range ranges[2] = {};
+    size_t count = add_byte_range(ranges, 0, 2, {3, 2}, 20, 0, 0);
+    ASSERT_EQ(1u, count);
+    ASSERT_EQ(3u, ranges[0].offset);
+    ASSERT_EQ(2u, ranges[0].length);
+    // touching ranges are merged
+    count = add_byte_range(ranges, count, 2, {5, 1}, 20, 1, 0);
+    ASSERT_EQ(1u, count);
+    ASSERT_EQ(3u, ranges[0].length);
+    count = add_byte_range(ranges, count, 2, {10, 1}, 20, 1, 0);
+    ASSERT_EQ(2u, count);
+    // full list extends last range
+    count = add_byte_range(ranges, count, 2, {15, 2}, 20, 1, 0);
+    ASSERT_EQ(2u, count);
+    ASSERT_EQ(10u, ranges[1].offset);
+    ASSERT_EQ(7u, ranges[1].length);
+
+    // pages of 4 bytes, data starts at 6
+    count = add_byte_range(ranges, 0, 2, {1, 1}, 20, 4, 6);
+    ASSERT_EQ(0u, ranges[0].offset);
+    ASSERT_EQ(2u, ranges[0].length);
+    count = add_byte_range(ranges, count, 2, {7, 2}, 20, 4, 6);
+    ASSERT_EQ(2u, count);
+    ASSERT_EQ(6u, ranges[1].offset);
+    ASSERT_EQ(4u, ranges[1].length);
+    count = add_byte_range(ranges, 1, 2, {18, 2}, 20, 4, 6);
+    ASSERT_EQ(18u, ranges[1].offset);
+    ASSERT_EQ(2u, ranges[1].length);
+    ASSERT_EQ(0u, add_byte_range(ranges, 0, 0, {0, 1}, 20, 4, 6));
+}
+
+static std::string to_hex(const uint8_t *digest, size_t size) {
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+    for (size_t i = 0; i < size; i++) {
+        hex.push_back(digits[digest[i] >> 4]);
+        hex.push_back(digits[digest[i] & 0x0F]);
+    }
+    return hex;
+}
+
+static std::string crc32_hex(std::vector<uint8_t> data, size_t piece) {
+    crc32_ctx ctx;
+    crc32_init(&ctx);
+    for (size_t i = 0; i < data.size(); i += piece) {
+        crc32_update(&ctx, data.data() + i, std::min(piece, data.size() - i));
+    }
+    uint8_t digest[CRC32_DIGEST_SIZE] = {0};
+    crc32_final(&ctx, digest);
+    return to_hex(digest, sizeof(digest));
+}
+
+static std::string sha256_hex(std::vector<uint8_t> data, size_t piece) {
+    sha256_ctx ctx;
+    sha256_init(&ctx);
+    for (size_t i = 0; i < data.size(); i += piece) {
+        sha256_update(&ctx, data.data() + i, std::min(piece, data.size() - i));
+    }
+    uint8_t digest[SHA256_DIGEST_SIZE] = {0};
+    sha256_final(&ctx, digest);
+    return to_hex(digest, sizeof(digest));
+}
+
+static std::vector<uint8_t> to_bytes(const std::string &str) {
+    return std::vector<uint8_t>(str.begin(), str.end());
+}
+
+TEST(eput_utils, crc32) {
+    ASSERT_EQ("00000000", crc32_hex({}, 1));
+    for (size_t piece : {1, 3, 8, 9, 100}) {
+        ASSERT_EQ("cbf43926", crc32_hex(to_bytes("123456789"), piece));
+        ASSERT_EQ("414fa339", crc32_hex(to_bytes("The quick brown fox jumps over the lazy dog"), piece));
+    }
+}
+
+TEST(eput_utils, sha256) {
+    ASSERT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", sha256_hex({}, 1));
+    ASSERT_EQ("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", sha256_hex(to_bytes("abc"), 1));
+    std::vector<uint8_t> two_blocks = to_bytes("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq");
+    std::vector<uint8_t> million(1000000, 'a');
+    for (size_t piece : {1, 7, 63, 64, 65, 1000}) {
+        ASSERT_EQ("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1", sha256_hex(two_blocks, piece));
+        ASSERT_EQ("cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0", sha256_hex(million, piece));
+    }
+}
+
+TEST(eput_utils, verify_digest) {
+    std::vector<uint8_t> data = to_bytes("abc");
+    uint8_t crc[CRC32_DIGEST_SIZE] = {0x35, 0x24, 0x41, 0xC2};
+    uint8_t sha[SHA256_DIGEST_SIZE] = {0};
+    sha256_ctx ctx;
+    sha256_init(&ctx);
+    sha256_update(&ctx, data.data(), data.size());
+    sha256_final(&ctx, sha);
+    ASSERT_EQ(SUCCESS, verify_digest(data.data(), data.size(), crc, sizeof(crc)));
+    ASSERT_EQ(SUCCESS, verify_digest(data.data(), data.size(), sha, sizeof(sha)));
+    data[1] = 'x';
+    ASSERT_EQ(ERR_DIGEST_MISMATCH, verify_digest(data.data(), data.size(), crc, sizeof(crc)));
+    ASSERT_EQ(ERR_DIGEST_MISMATCH, verify_digest(data.data(), data.size(), sha, sizeof(sha)));
+    ASSERT_EQ(ERR_DIGEST_UNSUPPORTED, verify_digest(data.data(), data.size(), sha, 16));
+}
+
+TEST(eput_utils, zlib_dictionary_id) {
+    std::vector<uint8_t> dictionary = to_bytes("eput dictionary");
+    ASSERT_EQ(0x2F910615u, get_dictionary_id(dictionary.data(), dictionary.size()));
+    ASSERT_EQ(1u, get_dictionary_id(NULL, 0));
+    std::vector<uint8_t> large;
+    for (size_t i = 0; i < 30; i++) {
+        for (size_t j = 0; j < 256; j++) {
+            large.push_back((uint8_t) j);
+        }
+    }
+    ASSERT_EQ(0x967DF1D3u, get_dictionary_id(large.data(), large.size()));
+
+    uint32_t id = 0;
+    uint8_t with_dictionary[] = {0x78, 0xF9, 0x2F, 0x91, 0x06, 0x15};
+    ASSERT_EQ(SUCCESS, get_zlib_dictionary_id(with_dictionary, sizeof(with_dictionary), &id));
+    ASSERT_EQ(0x2F910615u, id);
+    ASSERT_EQ(ERR_ZLIB_HEADER_INVALID, get_zlib_dictionary_id(with_dictionary, 5, &id));
+    uint8_t without_dictionary[] = {0x78, 0xDA};
+    ASSERT_EQ(SUCCESS, get_zlib_dictionary_id(without_dictionary, sizeof(without_dictionary), &id));
+    ASSERT_EQ(ZLIB_NO_DICTIONARY, id);
+    ASSERT_EQ(ERR_ZLIB_HEADER_INVALID, get_zlib_dictionary_id(without_dictionary, 1, &id));
+    without_dictionary[1] = 0xDB;
+    ASSERT_EQ(ERR_ZLIB_HEADER_INVALID, get_zlib_dictionary_id(without_dictionary, sizeof(without_dictionary), &id));
+}
+
+TEST(eput_utils, indexed_translations) {
+    // IDs temp, mode, off and on in languages en and de, "on" isn't translated
+    uint8_t section[] = {
+        TRANSLATIONS_INDEXED, 0x02, 0x00, 0x00, 0x00, 0x04,
+        0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x2F,
+        'e', 'n', 0x00, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x1C, 0x00, 0x20,
+        'T', 'e', 'm', 'p', 'e', 'r', 'a', 't', 'u', 'r', 'e', 0x00, 'M', 'o', 'd', 'e', 0x00, 'O', 'f', 'f', 0x00, 0x00,
+        'd', 'e', 0x00, 0x00, 0x0B, 0x00, 0x16, 0x00, 0x1C, 0x00, 0x1C,
+        'T', 'e', 'm', 'p', 'e', 'r', 'a', 't', 'u', 'r', 0x00, 'M', 'o', 'd', 'u', 's', 0x00, 0x00
+    };
+    translation_index index;
+    ASSERT_EQ(SUCCESS, open_translations(section, sizeof(section), &index));
+    ASSERT_EQ(2, index.language_count);
+    ASSERT_EQ(4u, index.id_count);
+    uint8_t en = 0xFF;
+    uint8_t de = 0xFF;
+    uint8_t fr = 0xFF;
+    ASSERT_EQ(SUCCESS, find_translation_language(&index, "en", &en));
+    ASSERT_EQ(SUCCESS, find_translation_language(&index, "de", &de));
+    ASSERT_EQ(ERR_TRANSLATION_NOT_FOUND, find_translation_language(&index, "fr", &fr));
+    ASSERT_EQ(ERR_TRANSLATION_NOT_FOUND, find_translation_language(&index, "d", &fr));
+    ASSERT_EQ(0, en);
+    ASSERT_EQ(1, de);
+
+    const char *text = NULL;
+    ASSERT_EQ(SUCCESS, get_translation(&index, en, 2, &text));
+    ASSERT_STREQ("Off", text);
+    ASSERT_EQ(SUCCESS, get_translation(&index, de, 1, &text));
+    ASSERT_STREQ("Modus", text);
+    ASSERT_EQ(SUCCESS, get_translation(&index, de, 2, &text));
+    ASSERT_STREQ("", text);
+    ASSERT_EQ(SUCCESS, get_translation(&index, de, 3, &text));
+    ASSERT_STREQ("", text);
+    ASSERT_EQ(ERR_TRANSLATION_NOT_FOUND, get_translation(&index, de, 4, &text));
+    ASSERT_EQ(ERR_TRANSLATION_NOT_FOUND, get_translation(&index, 2, 0, &text));
+
+    // Strings or tables reaching beyond the section are rejected
+    ASSERT_EQ(SUCCESS, open_translations(section, sizeof(section) - 1, &index));
+    ASSERT_EQ(SUCCESS, get_translation(&index, de, 1, &text));
+    ASSERT_EQ(ERR_TRANSLATIONS_INVALID, get_translation(&index, de, 2, &text));
+    ASSERT_EQ(SUCCESS, open_translations(section, 0x30, &index));
+    ASSERT_EQ(ERR_TRANSLATIONS_INVALID, get_translation(&index, de, 0, &text));
+    ASSERT_EQ(ERR_TRANSLATIONS_INVALID, open_translations(section, 13, &index));
+    section[0] = 'e';
+    ASSERT_EQ(ERR_TRANSLATIONS_INVALID, open_translations(section, sizeof(section), &index));
+}
+
+// ROM blob with CRC-32 digests in the layout of export_rom_blob
+static std::vector<uint8_t> make_rom_blob(const std::vector<std::vector<uint8_t>> &blobs) {
+    std::vector<uint8_t> rom = {(uint8_t) blobs.size(), CRC32_DIGEST_SIZE};
+    uint32_t start = (uint32_t) (ROM_BLOB_HEADER_SIZE + blobs.size() * (CRC32_DIGEST_SIZE + 8));
+    for (const std::vector<uint8_t> &blob : blobs) {
+        uint8_t descriptor[CRC32_DIGEST_SIZE + 8];
+        crc32_ctx ctx;
+        crc32_init(&ctx);
+        crc32_update(&ctx, (uint8_t *) blob.data(), blob.size());
+        crc32_final(&ctx, descriptor);
+        uint32_to_bytes(start, descriptor + CRC32_DIGEST_SIZE);
+        uint32_to_bytes((uint32_t) blob.size(), descriptor + CRC32_DIGEST_SIZE + 4);
+        rom.insert(rom.end(), descriptor, descriptor + sizeof(descriptor));
+        start += (uint32_t) blob.size();
+    }
+    for (const std::vector<uint8_t> &blob : blobs) {
+        rom.insert(rom.end(), blob.begin(), blob.end());
+    }
+    return rom;
+}
+
+TEST(eput_utils, rom_blob) {
+    std::vector<uint8_t> data = to_bytes("data blob");
+    std::vector<uint8_t> meta_en = to_bytes("en metadata");
+    std::vector<uint8_t> meta_de = to_bytes("de");
+    std::vector<uint8_t> rom_bytes = make_rom_blob({data, meta_en, meta_de});
+    rom_blob rom;
+    rom_blob_entry entry;
+    ASSERT_EQ(SUCCESS, open_rom_blob(rom_bytes.data(), rom_bytes.size(), &rom));
+    ASSERT_EQ(3, rom.count);
+    ASSERT_EQ(SUCCESS, get_rom_blob_data(&rom, &entry));
+    ASSERT_EQ(rom_bytes.data() + 2 + 3 * 12, entry.data);
+    ASSERT_EQ(data, std::vector<uint8_t>(entry.data, entry.data + entry.length));
+    ASSERT_EQ(SUCCESS, verify_rom_blob_entry(&rom, &entry));
+    ASSERT_EQ(SUCCESS, get_rom_blob_metadata(&rom, 1, &entry));
+    ASSERT_EQ(meta_de, std::vector<uint8_t>(entry.data, entry.data + entry.length));
+    ASSERT_EQ(SUCCESS, verify_rom_blob_entry(&rom, &entry));
+    ASSERT_EQ(ERR_ROM_BLOB_NOT_FOUND, get_rom_blob_metadata(&rom, 2, &entry));
+    ASSERT_EQ(ERR_ROM_BLOB_NOT_FOUND, get_rom_blob_metadata(&rom, UINT8_MAX, &entry));
+
+    ASSERT_EQ(SUCCESS, get_rom_blob_metadata(&rom, 0, &entry));
+    rom_bytes[rom_bytes.size() - 3] ^= 1;
+    ASSERT_EQ(ERR_DIGEST_MISMATCH, verify_rom_blob_entry(&rom, &entry));
+    for (size_t len = 0; len < rom_bytes.size(); len++) {
+        ASSERT_EQ(ERR_ROM_BLOB_INVALID, open_rom_blob(rom_bytes.data(), len, &rom));
+    }
+    rom_bytes[0] = 0;
+    ASSERT_EQ(ERR_ROM_BLOB_INVALID, open_rom_blob(rom_bytes.data(), rom_bytes.size(), &rom));
+}
+
+TEST(eput_utils, hash_bytes) {
+    std::vector<uint8_t> data = to_bytes("the quick brown fox jumps over the lazy dog");
+    uint64_t hash = hash_bytes(data.data(), data.size());
+    ASSERT_EQ(hash, hash_bytes(data.data(), data.size()));
+    for (size_t len = 0; len < data.size(); len++) {
+        ASSERT_NE(hash, hash_bytes(data.data(), len));
+    }
+    // Every byte counts, in the 32 byte blocks as well as the remainder
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] ^= 1;
+        ASSERT_NE(hash, hash_bytes(data.data(), data.size()));
+        data[i] ^= 1;
+    }
+    std::vector<uint8_t> zeros(40, 0);
+    ASSERT_NE(hash_bytes(zeros.data(), 39), hash_bytes(zeros.data(), 40));
+}
+
+#ifdef EPUT_TRACE
+TEST(eput_utils, trace) {
+    init_trace();
+    std::vector<uint8_t> buf = {TLV_TYPE_NULL, TLV_TYPE_NULL, TLV_TYPE_NDEF, 0x05, 0xD0 | TNF_URI, 0x00, 0x02, 0x01, 0x02, TLV_TYPE_TERMINATOR};
+    size_t offset = 0;
+    ndef_record rec = {};
+    ASSERT_EQ(5, get_ndef_tlv_offset(buf.data(), buf.size(), &offset));
+    ASSERT_EQ(5, get_record(buf.data() + offset, 5, &rec));
+    ASSERT_EQ(ERR_REC_BUF_TRUNCATED, get_record(buf.data() + offset, 4, &rec));
+
+    trace_stat stat = {};
+    ASSERT_EQ(SUCCESS, get_trace_stat(EPUT_TRACE_TLV_SCAN, &stat));
+    ASSERT_EQ(1u, stat.calls);
+    ASSERT_EQ(4u, stat.bytes);
+    ASSERT_GE(stat.ticks, stat.max_ticks);
+    ASSERT_EQ(SUCCESS, get_trace_stat(EPUT_TRACE_RECORD, &stat));
+    ASSERT_EQ(2u, stat.calls);
+    ASSERT_EQ(5u, stat.bytes);
+    ASSERT_EQ(ERR_TRACE_POINT_INVALID, get_trace_stat(EPUT_TRACE_POINT_COUNT, &stat));
+
+    record_trace(EPUT_TRACE_PARSE_PAYLOAD, 7, 3);
+    record_trace(EPUT_TRACE_PARSE_PAYLOAD, 5, 3);
+    record_trace(EPUT_TRACE_POINT_COUNT, 1, 1);
+    ASSERT_EQ(SUCCESS, get_trace_stat(EPUT_TRACE_PARSE_PAYLOAD, &stat));
+    ASSERT_EQ(2u, stat.calls);
+    ASSERT_EQ(12u, stat.ticks);
+    ASSERT_EQ(7u, stat.max_ticks);
+    ASSERT_EQ(6u, stat.bytes);
+    reset_trace_stats();
+    ASSERT_EQ(SUCCESS, get_trace_stat(EPUT_TRACE_PARSE_PAYLOAD, &stat));
+    ASSERT_EQ(0u, stat.calls);
+}
+#endif
+
+TEST(eput_utils, bitmap) {
+    std::vector<uint8_t> bitmap(11, 0);
+    std::vector<size_t> options = {0, 7, 9, 63, 64, 70, 87};
+    for (size_t option : options) {
+        select_option(bitmap.data(), bitmap.size(), (uint8_t) option);
+    }
+    select_option(bitmap.data(), bitmap.size(), 88);
+    for (size_t option = 0; option < bitmap.size() * 8; option++) {
+        bool selected = std::find(options.begin(), options.end(), option) != options.end();
+        ASSERT_EQ(selected, is_option_selected(bitmap.data(), bitmap.size(), (uint8_t) option));
+    }
+    ASSERT_EQ(0x8000000000000281ull, bitmap_to_uint64(bitmap.data(), bitmap.size()));
+    ASSERT_EQ(0x0281ull, bitmap_to_uint64(bitmap.data(), 2));
+    ASSERT_EQ(options.size(), count_selected_options(bitmap.data(), bitmap.size()));
+    ASSERT_EQ(3u, count_selected_options(bitmap.data(), 2));
+
+    std::vector<size_t> found;
+    for (size_t o = find_next_selected_option(bitmap.data(), bitmap.size(), 0);
+            o < bitmap.size() * 8;
+            o = find_next_selected_option(bitmap.data(), bitmap.size(), o + 1)) {
+        found.push_back(o);
+    }
+    ASSERT_EQ(options, found);
+    ASSERT_EQ(bitmap.size() * 8, find_next_selected_option(bitmap.data(), bitmap.size(), 88));
+    ASSERT_EQ(bitmap.size() * 8, find_next_selected_option(bitmap.data(), bitmap.size(), 1000));
+
+    deselect_option(bitmap.data(), bitmap.size(), 63);
+    deselect_option(bitmap.data(), bitmap.size(), 8);
+    ASSERT_EQ(0x0281ull, bitmap_to_uint64(bitmap.data(), bitmap.size()));
+    uint64_to_bitmap(0x0102ull, bitmap.data(), bitmap.size());
+    ASSERT_EQ(0x02, bitmap[0]);
+    ASSERT_EQ(0x01, bitmap[1]);
+    ASSERT_EQ(0x00, bitmap[7]);
+    ASSERT_EQ(0x41, bitmap[8]);
+    uint8_t small[1] = {0};
+    uint64_to_bitmap(0xFFFFull, small, 1);
+    ASSERT_EQ(0xFF, small[0]);
+}
+
+TEST(eput_utils, fixp_arithmetic) {
+    fixp32 temp = {2150, 2}; // 21.50
+    fixp32 offset = {-5, 1}; // -0.5
+    ASSERT_EQ(215, rescale_fixp32(temp, 1).unscaled);
+    ASSERT_EQ(215000, rescale_fixp32(temp, 4).unscaled);
+    ASSERT_EQ(22, fixp32_to_int32(temp, 0));
+    ASSERT_EQ(-22, fixp32_to_int32({-2150, 2}, 0));
+    ASSERT_EQ(21, fixp32_to_int32({2149, 2}, 0));
+    ASSERT_EQ(INT32_MAX, rescale_fixp32(temp, 12).unscaled);
+    ASSERT_EQ(0, rescale_fixp32(temp, -30).unscaled);
+    ASSERT_EQ(2100, add_fixp32(temp, offset).unscaled);
+    ASSERT_EQ(2, add_fixp32(temp, offset).scale);
+    ASSERT_EQ(INT32_MAX, add_fixp32({INT32_MAX, 0}, {1, 0}).unscaled);
+    ASSERT_EQ(-1075, multiply_fixp32(temp, offset).unscaled);
+    ASSERT_EQ(INT32_MIN, multiply_fixp32({INT32_MAX, 0}, {-3, 0}).unscaled);
+    ASSERT_EQ(0, compare_fixp32(temp, {215, 1}));
+    ASSERT_EQ(1, compare_fixp32(temp, {2149999, 5}));
+    ASSERT_EQ(-1, compare_fixp32(offset, {0, 0}));
+    ASSERT_EQ(1, compare_fixp32({1, -10}, {INT32_MAX, 0}));
+
+    fixp64 energy = {123456789012345ll, 3};
+    ASSERT_EQ(123456789012ll, fixp64_to_int64(energy, 0));
+    ASSERT_EQ(INT64_MAX, rescale_fixp64(energy, 10).unscaled);
+    ASSERT_EQ(1ll, rescale_fixp64({5000000000000000000ll, 19}, 0).unscaled);
+    ASSERT_EQ(0ll, rescale_fixp64({4999999999999999999ll, 19}, 0).unscaled);
+    ASSERT_EQ(123456789012346ll, add_fixp64(energy, {5, 4}).unscaled);
+    ASSERT_EQ(INT64_MIN, add_fixp64({INT64_MIN + 1, 0}, {-2, 0}).unscaled);
+    // Intermediate product doesn't fit 64 bits
+    ASSERT_EQ(3000000000000000000ll, multiply_fixp64({3000000000000000000ll, 9}, {1000000000000000000ll, 18}).unscaled);
+    ASSERT_EQ(-2ll, multiply_fixp64({-15, 1}, {1500000000000000000ll, 19}).unscaled);
+    ASSERT_EQ(INT64_MAX, multiply_fixp64({INT64_MAX, 0}, {2, -1}).unscaled);
+    ASSERT_EQ(3ll, multiply_divide_int64(INT64_MAX, 3, INT64_MAX));
+    ASSERT_EQ(-1, compare_fixp64({INT64_MAX, 0}, {1, -19}));
+    ASSERT_EQ(1, compare_fixp64({-1, 19}, {-1, 0}));
+    ASSERT_EQ(0, compare_fixp64({-1000, 3}, {-1, 0}));
 }
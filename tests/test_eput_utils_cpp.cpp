@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../src/eputgen/cpp/eput_utils.hpp"
+#include "ndef_tlv_cases.h"
+
+template <typename T>
+void test_codec(T val) {
+    std::uint8_t bytes[sizeof(T)] = {0};
+    eput::codec<T>::encode(val, bytes);
+    ASSERT_EQ(val, eput::codec<T>::decode(bytes));
+}
+
+TEST(eput_utils_cpp, integer_codec) {
+    std::uint8_t bytes[4] = {0};
+    eput::codec<std::uint32_t>::encode(0x01020304u, bytes);
+    ASSERT_EQ(0x01, bytes[0]);
+    ASSERT_EQ(0x04, bytes[3]);
+    std::uint8_t negative[2] = {0xFF, 0xFE};
+    ASSERT_EQ(-2, eput::codec<std::int16_t>::decode(negative));
+
+    test_codec<std::uint8_t>(std::numeric_limits<std::uint8_t>::max());
+    test_codec<std::uint16_t>(std::numeric_limits<std::uint16_t>::max());
+    test_codec<std::uint64_t>(std::numeric_limits<std::uint64_t>::max());
+    test_codec<std::int8_t>(std::numeric_limits<std::int8_t>::min());
+    test_codec<std::int32_t>(std::numeric_limits<std::int32_t>::min());
+    test_codec<std::int64_t>(std::numeric_limits<std::int64_t>::min());
+    test_codec<std::int64_t>(-1);
+    test_codec<float>(-1.5f);
+    test_codec<double>(std::numeric_limits<double>::max());
+    test_codec<bool>(true);
+}
+
+TEST(eput_utils_cpp, fields) {
+    std::vector<std::uint8_t> payload(32, 0);
+    using setpoint = eput::field<2, std::uint16_t>;
+    setpoint::encode(0xABCD, payload);
+    ASSERT_EQ(0xAB, payload[2]);
+    ASSERT_EQ(0xABCD, setpoint::decode(payload));
+
+    using label = eput::string_field<4, 5>;
+    label::type text = {'h', 'e', 'l', 'l', 'o', 'x'};
+    label::encode(text, payload);
+    label::type decoded = label::decode(payload);
+    ASSERT_EQ(std::string("hello"), reinterpret_cast<const char *>(decoded.data()));
+
+    using temp = eput::fixed_point_field<10, std::int32_t, 2>;
+    temp::encode({-1234, 2}, payload);
+    ASSERT_EQ(-1234, temp::decode(payload).unscaled);
+    ASSERT_EQ(2, temp::decode(payload).scale);
+
+    using alarm = eput::field<14, eput::time_range>;
+    alarm::encode({{7, 30, 0}, {8, 15, 59}}, payload);
+    ASSERT_EQ(59, alarm::decode(payload).to.seconds);
+
+    using table = eput::array_field<20, 2, 6>;
+    static_assert(table::size == 12, "array size");
+    eput::span<std::uint8_t> entry = table::entry(eput::span<std::uint8_t>(payload), 3);
+    eput::field<0, std::uint16_t>::encode(0x0102, entry);
+    ASSERT_EQ(0x02, payload[27]);
+
+    // Selection of 3 bits straddling bytes 30 and 31 next to a bool
+    using flag = eput::bit_field<30, 5, 1, bool>;
+    using choice = eput::bit_field<30, 6, 3, std::uint8_t>;
+    eput::bit_field_bytes<30, 2>::clear(payload);
+    flag::encode(true, payload);
+    choice::encode(5, payload);
+    ASSERT_EQ(0x60, payload[30]);
+    ASSERT_EQ(0x01, payload[31]);
+    ASSERT_TRUE(flag::decode(payload));
+    ASSERT_EQ(5, choice::decode(payload));
+    choice::encode(2, payload);
+    ASSERT_TRUE(flag::decode(payload));
+    ASSERT_EQ(2, choice::decode(payload));
+
+    constexpr eput::limits<std::int16_t> limits{true, -10, true, 10, false, 0};
+    static_assert(limits.clamp(-20) == -10, "min");
+    static_assert(limits.clamp(5) == 5, "in range");
+    static_assert(limits.clamp(20) == 10, "max");
+}
+
+TEST(eput_utils_cpp, ndef) {
+    std::string type = std::string(eput::RECORD_TYPE_SCHEME) + "/data";
+    std::vector<std::uint8_t> message = {0x80 | 0x10 | eput::TNF_URI, static_cast<std::uint8_t>(type.size()), 3};
+    message.insert(message.end(), type.begin(), type.end());
+    message.insert(message.end(), {1, 2, 3});
+    std::vector<std::uint8_t> memory = {0x00, 0x01, 0x03, 0xA0, 0x0C, 0x34, eput::TLV_TYPE_NDEF, 0xFF, 0x00};
+    memory.push_back(static_cast<std::uint8_t>(message.size()));
+    memory.insert(memory.end(), message.begin(), message.end());
+    memory.push_back(eput::TLV_TYPE_TERMINATOR);
+
+    eput::span<const std::uint8_t> found;
+    ASSERT_EQ(eput::SUCCESS, eput::find_ndef_message(memory, found));
+    ASSERT_EQ(message.size(), found.size());
+    eput::ndef_record rec{};
+    ASSERT_EQ(static_cast<int>(message.size()), eput::get_data_record(found, rec));
+    ASSERT_EQ(3u, rec.payload.size());
+    ASSERT_EQ(3, rec.payload[2]);
+
+    for (std::size_t len = 0; len < message.size(); len++) {
+        ASSERT_EQ(eput::ERR_REC_BUF_TRUNCATED, eput::get_record(eput::span<const std::uint8_t>(message.data(), len), rec));
+    }
+    message[3] = 'x';
+    ASSERT_EQ(eput::ERR_REC_WRONG_TYPE, eput::get_data_record(message, rec));
+    std::vector<std::uint8_t> truncated(memory.begin(), memory.begin() + 12);
+    ASSERT_EQ(eput::ERR_NO_NDEF_TLV, eput::find_ndef_message(truncated, found));
+    std::uint8_t terminated[] = {0x00, eput::TLV_TYPE_TERMINATOR, eput::TLV_TYPE_NDEF, 0x01, 0x00};
+    ASSERT_EQ(eput::ERR_NO_NDEF_TLV, eput::find_ndef_message(terminated, found));
+}
+
+// Same cases as get_ndef_tlv_offset in test_eput_utils.cpp
+TEST(eput_utils_cpp, ndef_tlv_cases) {
+    for (ndef_tlv_case &test_case : ndef_tlv_cases()) {
+        SCOPED_TRACE(test_case.name);
+        eput::span<const std::uint8_t> found;
+        int ret = eput::find_ndef_message(test_case.memory, found);
+        if (test_case.length == 0) {
+            ASSERT_EQ(eput::ERR_NO_NDEF_TLV, ret);
+        } else {
+            ASSERT_EQ(eput::SUCCESS, ret);
+            ASSERT_EQ(test_case.memory.data() + test_case.offset, found.data());
+            ASSERT_EQ(test_case.length, found.size());
+        }
+    }
+}
+
+TEST(eput_utils_cpp, zlib_dictionary_id) {
+    constexpr std::uint8_t dictionary[] = {'e', 'p', 'u', 't', ' ', 'd', 'i', 'c', 't', 'i', 'o', 'n', 'a', 'r', 'y'};
+    static_assert(eput::get_dictionary_id(eput::span<const std::uint8_t>(dictionary)) == 0x2F910615u, "dictionary id");
+    std::uint32_t id = 0;
+    std::uint8_t with_dictionary[] = {0x78, 0xF9, 0x2F, 0x91, 0x06, 0x15};
+    ASSERT_EQ(eput::SUCCESS, eput::get_zlib_dictionary_id(with_dictionary, id));
+    ASSERT_EQ(0x2F910615u, id);
+    std::uint8_t without_dictionary[] = {0x78, 0xDA};
+    ASSERT_EQ(eput::SUCCESS, eput::get_zlib_dictionary_id(without_dictionary, id));
+    ASSERT_EQ(eput::ZLIB_NO_DICTIONARY, id);
+    ASSERT_EQ(eput::ERR_ZLIB_HEADER_INVALID, eput::get_zlib_dictionary_id(eput::span<const std::uint8_t>(with_dictionary, 5), id));
+}
+
+TEST(eput_utils_cpp, rom_blob) {
+    // Data blob and one metadata set with 4 byte digests
+    std::vector<std::uint8_t> blob = {2, 4};
+    blob.insert(blob.end(), {0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 3});
+    blob.insert(blob.end(), {0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 2});
+    blob.insert(blob.end(), {1, 2, 3, 4, 5});
+
+    eput::rom_blob rom;
+    eput::rom_blob_entry entry;
+    ASSERT_EQ(eput::SUCCESS, eput::rom_blob::open(blob, rom));
+    ASSERT_EQ(2u, rom.count());
+    ASSERT_EQ(eput::SUCCESS, rom.data(entry));
+    ASSERT_EQ(blob.data() + 26, entry.data.data());
+    ASSERT_EQ(3u, entry.data.size());
+    ASSERT_EQ(eput::SUCCESS, rom.metadata(0, entry));
+    ASSERT_EQ(5, entry.data[1]);
+    ASSERT_EQ(eput::ERR_ROM_BLOB_NOT_FOUND, rom.metadata(1, entry));
+    ASSERT_EQ(eput::ERR_ROM_BLOB_INVALID, eput::rom_blob::open(eput::span<const std::uint8_t>(blob.data(), 30), rom));
+
+#ifdef EPUT_HAS_MMAP
+    std::string path = testing::TempDir() + "eput_rom_blob.bin";
+    std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char *>(blob.data()), blob.size());
+    eput::mapped_file file;
+    ASSERT_EQ(eput::SUCCESS, file.open(path.c_str()));
+    eput::mapped_file moved = std::move(file);
+    ASSERT_EQ(0u, file.bytes().size());
+    ASSERT_EQ(eput::SUCCESS, eput::rom_blob::open(moved.bytes(), rom));
+    ASSERT_EQ(eput::SUCCESS, rom.metadata(0, entry));
+    ASSERT_EQ(4, entry.data[0]);
+    std::remove(path.c_str());
+    ASSERT_EQ(eput::ERR_ROM_BLOB_MAP_FAILED, file.open(path.c_str()));
+#endif
+}